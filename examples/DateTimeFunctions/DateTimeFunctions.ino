@@ -6,11 +6,12 @@
 //     Set: DateFormat(setDFormat), ClockFormat(setCFormat), DateZero(setDZero), HourZero(setHZero).
 //   Check: LeapYear(isLeap), AMorPM(isPM).
 //     Get: DayOfYear(getDOY), DayOfWeek(getDOW), DayOfWeekNameShort(getDOWNS), DayOfWeekNameLong(getDOWNL), WeekOfYear(getWOY),
-//    -||-: WeeksInYear(getWIY), DaysInYear(getDIY), DaysLeftInYear(getDLIY), DaysInMonth(getDIM), MonthNameShort(getMNS),
-//    -||-: MonthNameLong(getMNL), DaysBetweenDate(getDBD), SecondsFromMidnight(getSFM), MinutesFromMidnight(getMFM) AMorPM(getAMPM).
+//    -||-: WeeksInYear(getWIY), DaysInYear(getDIY), DaysLeftInYear(getDLIY), DaysInMonth(getDIM), EasterSunday(getEaster),
+//    -||-: MonthNameShort(getMNS), MonthNameLong(getMNL), DaysBetweenDate(getDBD), SecondsFromMidnight(getSFM), MinutesFromMidnight(getMFM) AMorPM(getAMPM).
 // Convert: 24To12hour(con24To12), 12To24Hour(con12To24), DoyToDate(conDOY2DATE), DoyToDay(conDOY2D), DoyToMonth(conDOY2M),
 //    -||-: DateTimeToUnixTime(conDT2UT), UnixTimeToDateTime(conUT2DT), SecondsToDateTime(conSec2DT), SecondsToTime(conSec2Time),
-//    -||-: DateTimeToSeconds(conDT2Sec), TimeToSeconds(conTime2Sec), NumbersToRomanNumerals(conNum2Roman), GregorianToJulianCalendar(conGre2Jul).
+//    -||-: DateTimeToSeconds(conDT2Sec), TimeToSeconds(conTime2Sec), NumbersToRomanNumerals(conNum2Roman),
+//    -||-: RomanNumeralsToNumbers(conRoman2Num), GregorianToJulianCalendar(conGre2Jul).
 //    Date: DateToString(date2Str).
 //   Clock: ClockToString(clock2Str), ClockToStringAM/PM(clock2StrAMPM),
 //    -||-: SecondsToClock(sec2Clock), SecondsToClockAM/PM(sec2ClockAMPM),
@@ -113,6 +114,11 @@ void setup() {
   // Get Days In Month - getDIM(month, year) = Returns: 28-31 (uint8_t)
   Serial.print(F("Days In Month: ")); Serial.println(dTF.getDIM(month, year));
 
+  // Get Easter Sunday - getEaster(year, day, month) = Sets: day & month (uint8_t)
+  uint8_t easterDay, easterMonth;                // Easter Sunday
+  dTF.getEaster(year, easterDay, easterMonth);   // 09/04/2023
+  Serial.print(F("Easter Sunday: ")); Serial.println(dTF.date2Str(easterDay, easterMonth, year));
+
   // Get Month Name Short - getMNS(month) = Returns: Jan-Dec (char)
   Serial.print(F("Month Name Short: ")); Serial.println(dTF.getMNS(month));
 
@@ -214,10 +220,26 @@ void setup() {
   const uint16_t _year = 2023U;                  // 2023 Is Written Like: MMXXIII
   Serial.print(F("Number To Roman: ")); Serial.println(dTF.conNum2Roman(_year));
 
+  // Convert Roman Numerals To Number - conRoman2Num("N"-"MMMMMMMMMM") = Returns: 0-10000 Or 65535 On Error (uint16_t)
+  Serial.print(F("Roman To Number: ")); Serial.println(dTF.conRoman2Num("MMXXIII"));
+
   // Convert Gregorian To Julian Calendar - conGre2Jul(day, month, year, false/true) = Returns: DD/MM/YYYY Or DD/Jan/YYYY (char)
   Serial.print(F("Gregorian To Julian: ")); Serial.println(dTF.conGre2Jul(day, month, year));       // DD/MM/YYYY
   //Serial.print(F("Gregorian To Julian: ")); Serial.println(dTF.conGre2Jul(day, month, year, true)); // DD/Jan/YYYY
 
+  // Convert Seconds To Duration - conSec2Dur(seconds, duration, false/true) = Sets: duration (DateTimeDuration)
+  // Duration To String - dur2Str(buffer, duration, style) = Returns: buffer (char)
+  DateTimeDuration duration;                     // Years, Days, Hours, Minutes, Seconds & Millis
+  char durationBuffer[40];                       // Duration String Buffer
+  dTF.conSec2Dur(TotalSeconds64, duration, true); // = 1.year, 4.days, 15.hours, 23.min, 20.sec
+  Serial.print(F("Seconds To Duration: ")); Serial.println(dTF.dur2Str(durationBuffer, duration, DATETIMEFUNCTIONS_DURATION_COMPACT)); // 1y 4d 15:23:20
+  Serial.print(F("Seconds To Duration: ")); Serial.println(dTF.dur2Str(durationBuffer, duration, DATETIMEFUNCTIONS_DURATION_ISO));     // P1Y4DT15H23M20S
+  Serial.print(F("Seconds To Duration: ")); Serial.println(dTF.dur2Str(durationBuffer, duration, DATETIMEFUNCTIONS_DURATION_CLOCK));   // 8871:23:20
+
+  // Convert ISO 8601 Duration To Milliseconds - conISO2Ms("PnYnWnDTnHnMnS", millis) = Returns: true If Valid (bool)
+  uint64_t durationMillis;                       // Milliseconds
+  if (dTF.conISO2Ms("PT26H3M4.5S", durationMillis)) { Serial.print(F("ISO 8601 To Milliseconds: ")); Serial.println((uint32_t)durationMillis); }
+
   //--------------------- Date ----------------------//
   Serial.println(F("\nDate."));
   
@@ -306,6 +328,9 @@ void setup() {
   // Roman Clock - romanClock12(hour, minute) = Returns: I:N ... XII:LIX (char)
   Serial.print(F("Roman Clock 12: ")); Serial.println(dTF.romanClock12(hour, minute));
 
+  // Print Straight To Serial - printDateTime(Serial, unixTime, false/true) = Returns: Characters Printed - No Buffer
+  Serial.print(F("Print Date Time: ")); dTF.printDateTime(Serial, unixTime, true); Serial.println();
+
   Serial.println(F("\nDone."));
 
   /* Serial Outputs:
@@ -327,6 +352,7 @@ void setup() {
      Days In Year: 365
      Days Left In Year: 306
      Days In Month: 28
+     Easter Sunday: 09/04/2023
      Month Name Short: Feb
      Month Name Long: February
      Days Between Date: 1395
@@ -349,7 +375,12 @@ void setup() {
      Date Time To Seconds: 3079400
      Time To Seconds: 31937000
      Number To Roman: MMXXIII
+     Roman To Number: 2023
      Gregorian To Julian: 15/02/2023
+     Seconds To Duration: 1y 4d 15:23:20
+     Seconds To Duration: P1Y4DT15H23M20S
+     Seconds To Duration: 8871:23:20
+     ISO 8601 To Milliseconds: 93784500
 
      Date.
      Date To String: 28/02/2023
@@ -368,6 +399,7 @@ void setup() {
      Seconds To Clock With AM PM: 1:20 PM
      Roman Clock 24: XX:N
      Roman Clock 12: VIII:N
+     Print Date Time: 28/Feb/2023 - 20:00:00
 
      Done.
   */
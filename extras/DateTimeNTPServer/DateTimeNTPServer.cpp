@@ -0,0 +1,159 @@
+//
+//    FILE: DateTimeNTPServer.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Host (Linux) tool. Stand-in NTP server on localhost for testing DateTimeNTP, with a set offset, delay & loss.
+//    -||-: With -c it also runs DateTimeNTP against itself and checks the clock it sets.
+//   Build: g++ -O2 -std=c++11 -pthread -DDATETIMENTP_GAP=100 -I../../src DateTimeNTPServer.cpp ../../src/DateTimeNTP.cpp ../../src/DateTimeClock.cpp ../../src/DateTimeFunctions.cpp -o DateTimeNTPServer
+//   Usage: DateTimeNTPServer [-p port] [-o offset ms] [-d delay ms] [-l loss %] [-c]
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// How it works:
+// The server answers each request on 127.0.0.1 with the host clock plus the offset, as a stratum 1
+// server. The delay is split in two: half before the receive time is taken & half after the send
+// time, so it looks like an even network path and the offset the client finds should be exact.
+// -l drops that percent of the requests, which the client has to ride out with its timeout.
+
+#include <DateTimeNTP.h>                         // Include The DateTimeNTP Library
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+// Settings
+static uint16_t _PORT_    = 12300;               // Server Port
+static int32_t _OFFSET_   = 0;                   // Server Clock - Host Clock, Milliseconds
+static uint32_t _DELAY_   = 0;                   // Round Trip Delay To Add, Milliseconds
+static uint8_t _LOSS_     = 0;                   // Requests To Drop, Percent
+static std::atomic<bool> _stop(false);           // Stop The Server
+
+// Host Clock Plus The Offset As NTP 32.32 Fixed Point
+static uint64_t ntpNow() {
+  struct timespec _ts;
+  clock_gettime(CLOCK_REALTIME, &_ts);           // Host Clock
+  int64_t _ns = (int64_t)_ts.tv_sec * 1000000000LL + _ts.tv_nsec + (int64_t)_OFFSET_ * 1000000LL; // Unix Nanoseconds
+  const uint64_t _SEC = (uint64_t)(_ns / 1000000000LL) + 2208988800ULL; // NTP Seconds
+  const uint64_t _FRAC = ((uint64_t)(_ns % 1000000000LL) << 32) / 1000000000ULL; // 1/2^32.sec
+  return (_SEC << 32) | _FRAC;
+}
+
+// Write A 32.32 Timestamp - Big Endian
+static void putStamp(uint8_t* _p, const uint64_t _T) {
+  for (uint8_t _i = 0; _i < 8; _i++) _p[_i] = (uint8_t)(_T >> (56 - 8 * _i));
+}
+
+// Sleep Milliseconds
+static void sleepMs(const uint32_t _MS) {
+  if (_MS) std::this_thread::sleep_for(std::chrono::milliseconds(_MS));
+}
+
+// Serve Requests Until _stop
+static void serve(const int _FD, const bool _QUIET) {
+  uint8_t _packet[DATETIMENTP_PACKET];
+  while (!_stop) {
+    struct sockaddr_in _from;
+    socklen_t _fromLen = sizeof(_from);
+    const ssize_t _N = recvfrom(_FD, _packet, sizeof(_packet), 0, (struct sockaddr*)&_from, &_fromLen);
+    if (_N < DATETIMENTP_PACKET || (_packet[0] & 0x07) != 3) continue; // Time Out Or Not A Client Request
+    if (_LOSS_ && (uint8_t)(rand() % 100) < _LOSS_) { if (!_QUIET) fprintf(stderr, "dropped\n"); continue; }
+    sleepMs(_DELAY_ / 2);                        // Way In
+    const uint64_t _T2 = ntpNow();               // Receive Time
+    memcpy(_packet + 24, _packet + 40, 8);       // Originate = The Client Transmit Time
+    _packet[0] = (uint8_t)((_packet[0] & 0x38) | 4); // LI = 0, Same Version, Mode = 4 (Server)
+    _packet[1] = 1;                              // Stratum 1
+    _packet[3] = (uint8_t)-20;                   // Precision ~1.us
+    memset(_packet + 4, 0, 8);                   // Root Delay & Dispersion
+    memcpy(_packet + 12, "LOCL", 4);             // Reference ID
+    putStamp(_packet + 16, _T2);                 // Reference Time
+    putStamp(_packet + 32, _T2);                 // Receive Time
+    putStamp(_packet + 40, ntpNow());            // Transmit Time
+    sleepMs(_DELAY_ - _DELAY_ / 2);              // Way Out
+    sendto(_FD, _packet, sizeof(_packet), 0, (struct sockaddr*)&_from, _fromLen);
+    if (!_QUIET) fprintf(stderr, "answered %s:%u\n", inet_ntoa(_from.sin_addr), ntohs(_from.sin_port));
+  }
+}
+
+// Run DateTimeNTP Against The Server - Returns: 0 If The Clock Is Right
+static int check() {
+  DateTimeClock _clk(DateTimeClock::hostMillis, 1000UL);
+  DateTimeNTPHostUDP _udp("127.0.0.1", _PORT_);
+  DateTimeNTP _ntp(_udp, _clk, DateTimeClock::hostMillis);
+  int _fails = 0;
+  for (uint8_t _round = 0; _round < 2; _round++) {
+    _ntp.start();
+    uint8_t _event;
+    uint32_t _polls = 0;
+    double _longest = 0;                         // Longest poll() In Microseconds
+    do {
+      const auto _T0 = std::chrono::steady_clock::now();
+      _event = _ntp.poll();
+      const double _US = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _T0).count();
+      if (_US > _longest) _longest = _US;
+      _polls++;
+      std::this_thread::sleep_for(std::chrono::microseconds(200)); // The Rest Of loop()
+    } while (_event == DATETIMENTP_BUSY);
+    struct timespec _ts;
+    clock_gettime(CLOCK_REALTIME, &_ts);
+    const int64_t _WANT = (int64_t)_ts.tv_sec * 1000LL + _ts.tv_nsec / 1000000L + _OFFSET_; // Server Time Now
+    const int64_t _ERROR = (int64_t)_clk.nowMillis() - _WANT;
+    const bool _OK = (_event == DATETIMENTP_SYNCED) && _ERROR >= -3 && _ERROR <= 3;
+    fprintf(stderr, "round %u: %s, error %lld ms, delay %u us, offset %d ms, %u polls, longest poll %.0f us\n", _round + 1,
+            _event == DATETIMENTP_SYNCED ? "synced" : "failed", (long long)_ERROR, _ntp.getDelay(), _ntp.getOffset(), _polls, _longest);
+    _fails += !_OK;
+  }
+  fprintf(stderr, "%s\n", _fails ? "FAIL" : "OK");
+  return _fails ? 1 : 0;
+}
+
+// Print The Usage
+static int usage() {
+  fprintf(stderr, "Usage: DateTimeNTPServer [-p port] [-o offset ms] [-d delay ms] [-l loss %%] [-c]\n");
+  return 2;
+}
+
+
+int main(int argc, char** argv) {
+  // Read The Options
+  bool _check = false;                           // Run The Client Check
+  int _opt;
+  while ((_opt = getopt(argc, argv, "p:o:d:l:c")) != -1) {
+    if (_opt == 'p') _PORT_ = (uint16_t)atoi(optarg);
+    else if (_opt == 'o') _OFFSET_ = atoi(optarg);
+    else if (_opt == 'd') _DELAY_ = (uint32_t)atoi(optarg);
+    else if (_opt == 'l') _LOSS_ = (uint8_t)atoi(optarg);
+    else if (_opt == 'c') _check = true;
+    else return usage();
+  }
+
+  // Open The Socket On 127.0.0.1
+  const int _FD = socket(AF_INET, SOCK_DGRAM, 0);
+  if (_FD < 0) { perror("socket"); return 1; }
+  struct sockaddr_in _addr;
+  memset(&_addr, 0, sizeof(_addr));
+  _addr.sin_family = AF_INET;
+  _addr.sin_port = htons(_PORT_);
+  _addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(_FD, (struct sockaddr*)&_addr, sizeof(_addr)) != 0) { perror("bind"); return 1; }
+  struct timeval _tv = {0, 100000};              // 100.ms, So _stop Is Seen
+  setsockopt(_FD, SOL_SOCKET, SO_RCVTIMEO, &_tv, sizeof(_tv));
+
+  if (!_check) {                                 // Serve Until Killed
+    fprintf(stderr, "NTP on 127.0.0.1:%u, offset %d ms, delay %u ms, loss %u %%\n", _PORT_, _OFFSET_, _DELAY_, _LOSS_);
+    serve(_FD, false);
+    return 0;
+  }
+  std::thread _server(serve, _FD, true);         // Serve In The Background
+  const int _RESULT = check();                   // Run The Client
+  _stop = true;
+  _server.join();
+  close(_FD);
+  return _RESULT;
+}
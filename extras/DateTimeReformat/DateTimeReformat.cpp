@@ -0,0 +1,259 @@
+//
+//    FILE: DateTimeReformat.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Host (Linux) tool. Reformat Unix time columns in big text files to the DateTimeFunctions date time format.
+//    -||-: Uses the same conUT2DT() as the devices, so server and device output match byte for byte.
+//   Build: g++ -O2 -std=c++11 -pthread -I../../src DateTimeReformat.cpp ../../src/DateTimeFunctions.cpp -o DateTimeReformat
+//   Usage: DateTimeReformat [-t threads] [-c column] [-d delimiter] [-m] input.txt output.txt
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// How it works:
+// The input is mmap'ed and split into line aligned chunks. Each worker thread owns a deque of chunks,
+// takes work from the front of its own deque and steals from the back of the others when it runs dry.
+// Every chunk is converted into its own pre-sized output buffer, and the main thread writes the
+// buffers to the output file in order as soon as they are done.
+
+#include <DateTimeFunctions.h>                   // Include The DateTimeFunctions Library
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Settings
+static uint32_t _COLUMN_    = 0;                 // Column With The Unix Time (0 = First)
+static char _DELIMITER_     = ',';               // Column Delimiter
+static bool _USEMONTHNAME_  = false;             // false = DD/MM/YYYY - HH:MM:SS & true = DD/Jan/YYYY - HH:MM:SS
+static const uint8_t _MAXDT_ = 26;               // Max Date Time String Length From conUT2DT()
+
+// One Line Aligned Chunk Of The Input
+struct Chunk {
+  const char* _in;                               // Input Start
+  size_t _inLen;                                 // Input Length
+  char* _out;                                    // Output Buffer
+  size_t _outLen;                                // Output Length
+  uint64_t _lines;                               // Lines In Chunk
+  bool _done;                                    // Chunk Is Converted
+};
+
+// Work Stealing Deque - One Per Worker
+struct WorkQueue {
+  std::mutex _lock;                              // Deque Lock
+  std::deque<size_t> _chunks;                    // Chunk Indexes
+};
+
+static std::vector<Chunk> _chunks;               // All Chunks
+static std::deque<WorkQueue> _queues;            // All Worker Queues - A Deque Never Moves Them
+static std::mutex _doneLock;                     // Done Lock
+static std::condition_variable _doneSignal;      // Done Signal
+static std::atomic<bool> _failed(false);         // Out Of Memory Or The Output Failed - Stop The Run
+
+
+// Convert One Line - Returns: Output Length
+static size_t convertLine(DateTimeFunctions& _dTF, const char* _line, const size_t _len, char* _out) {
+  size_t _i = 0, _o = 0;                         // Input & Output Index
+  uint32_t _column = 0;                          // Column Counter
+  // Copy The Columns Before The Unix Time Column
+  while (_i < _len && _column < _COLUMN_) {
+    if (_line[_i] == _DELIMITER_) _column++;     // Next Column
+    _out[_o++] = _line[_i++];                    // Copy
+  }
+  // Read The Unix Time
+  const size_t _START = _i;                      // Column Start
+  uint64_t _unixTime = 0;                        // Unix Time
+  bool _fits = true;                             // Fits In 64.bits
+  while (_i < _len && _line[_i] >= '0' && _line[_i] <= '9') {
+    const uint8_t _DIGIT = _line[_i++] - '0';
+    if (_unixTime > (UINT64_MAX - _DIGIT) / 10U) _fits = false; // Too Big - Keep The Column
+    _unixTime = _unixTime * 10U + _DIGIT;
+  }
+  // Convert Only A Clean Number Column, Else Leave The Line As It Is
+  if (_fits && _i > _START && (_i == _len || _line[_i] == _DELIMITER_ || _line[_i] == '\r')) {
+    char* _dt = _dTF.conUT2DT(_out + _o, _unixTime, _USEMONTHNAME_); // Convert Into The Output
+    _o += strlen(_dt);                           // Move Past The String
+  }
+  else _i = _START;                              // Copy The Column As It Is
+  // Copy The Rest Of The Line
+  memcpy(_out + _o, _line + _i, _len - _i);
+  return _o + (_len - _i);
+}
+
+// Convert One Chunk Into Its Own Buffer - Returns: false If Out Of Memory
+static bool convertChunk(DateTimeFunctions& _dTF, Chunk& _chunk) {
+  // Count The Lines To Size The Output Buffer
+  uint64_t _lines = 0;                           // Lines
+  const char* _p = _chunk._in;                   // Scan Pointer
+  const char* _END = _chunk._in + _chunk._inLen; // End Of Chunk
+  while ((_p = (const char*)memchr(_p, '\n', _END - _p)) != NULL) { _lines++; _p++; }
+  _chunk._out = (char*)malloc(_chunk._inLen + (_lines + 1) * (_MAXDT_ + 1)); // Worst Case Size
+  if (!_chunk._out) return false;                // Out Of Memory
+
+  // Convert Line By Line
+  const char* _line = _chunk._in;                // Line Start
+  size_t _o = 0;                                 // Output Index
+  while (_line < _END) {
+    const char* _nl = (const char*)memchr(_line, '\n', _END - _line);
+    const size_t _LEN = (_nl ? _nl : _END) - _line;
+    _o += convertLine(_dTF, _line, _LEN, _chunk._out + _o);
+    if (_nl) _chunk._out[_o++] = '\n';           // Add The New Line
+    _line += _LEN + 1;                           // Next Line
+  }
+  _chunk._outLen = _o;                           // Output Length
+  _chunk._lines = _lines;                        // Line Count
+  return true;
+}
+
+// Take The Next Chunk - Own Queue Front First, Then Steal From The Back Of The Others
+static bool takeChunk(const size_t _SELF, size_t& _index) {
+  for (size_t _n = 0; _n < _queues.size() && !_failed; _n++) {
+    WorkQueue& _q = _queues[(_SELF + _n) % _queues.size()];
+    std::lock_guard<std::mutex> _guard(_q._lock);
+    if (_q._chunks.empty()) continue;            // Try The Next Queue
+    if (_n == 0) { _index = _q._chunks.front(); _q._chunks.pop_front(); } // Own Work
+    else { _index = _q._chunks.back(); _q._chunks.pop_back(); }            // Steal
+    return true;
+  }
+  return false;                                  // No Work Left
+}
+
+// Worker Thread
+static void worker(const size_t _SELF) {
+  DateTimeFunctions _dTF;                        // Formatter - conUT2DT(buffer, ...) Is Reentrant
+  size_t _index;                                 // Chunk Index
+  while (takeChunk(_SELF, _index)) {
+    const bool _OK = convertChunk(_dTF, _chunks[_index]); // Convert
+    std::lock_guard<std::mutex> _guard(_doneLock);
+    if (!_OK) _failed = true;                    // Stop Everyone
+    _chunks[_index]._done = true;                // Mark Done
+    _doneSignal.notify_one();                    // Wake The Writer
+  }
+}
+
+// Read A Whole Number Option In _MIN ... _MAX - Returns: false If Not A Number Or Out Of Range
+static bool readOption(const char* _TEXT, const unsigned long _MIN, const unsigned long _MAX, unsigned long& _value) {
+  char* _end = NULL;                             // End Of The Number
+  errno = 0;
+  _value = strtoul(_TEXT, &_end, 10);
+  return _end != _TEXT && *_end == '\0' && errno == 0 && _TEXT[0] != '-' && _value >= _MIN && _value <= _MAX;
+}
+
+// Print The Usage
+static int usage() {
+  fprintf(stderr, "Usage: DateTimeReformat [-t threads] [-c column] [-d delimiter] [-m] input.txt output.txt\n");
+  return 2;
+}
+
+
+int main(int argc, char** argv) {
+  // Read The Options
+  unsigned _threads = std::thread::hardware_concurrency(); // Threads
+  unsigned long _value;                          // Option Value
+  int _opt;
+  while ((_opt = getopt(argc, argv, "t:c:d:m")) != -1) {
+    if (_opt == 't') {                           // 1 ... 1024 Threads
+      if (!readOption(optarg, 1UL, 1024UL, _value)) { fprintf(stderr, "threads: 1-1024, not %s\n", optarg); return usage(); }
+      _threads = (unsigned)_value;
+    }
+    else if (_opt == 'c') {                      // Column 0 ... 4294967294
+      if (!readOption(optarg, 0UL, 0xFFFFFFFEUL, _value)) { fprintf(stderr, "column: 0-4294967294, not %s\n", optarg); return usage(); }
+      _COLUMN_ = (uint32_t)_value;
+    }
+    else if (_opt == 'd') _DELIMITER_ = optarg[0];
+    else if (_opt == 'm') _USEMONTHNAME_ = true;
+    else return usage();
+  }
+  if (argc - optind != 2) return usage();
+  if (_threads == 0) _threads = 1;
+
+  // Map The Input
+  const int _IN = open(argv[optind], O_RDONLY);
+  if (_IN < 0) { perror(argv[optind]); return 1; }
+  struct stat _st;
+  if (fstat(_IN, &_st) != 0) { perror("fstat"); return 1; }
+  const size_t _SIZE = (size_t)_st.st_size;
+  const char* _data = NULL;
+  if (_SIZE > 0) {
+    _data = (const char*)mmap(NULL, _SIZE, PROT_READ, MAP_PRIVATE, _IN, 0);
+    if (_data == MAP_FAILED) { perror("mmap"); return 1; }
+    madvise((void*)_data, _SIZE, MADV_SEQUENTIAL);
+  }
+  FILE* _out = fopen(argv[optind + 1], "wb");
+  if (!_out) { perror(argv[optind + 1]); return 1; }
+
+  // Split Into Line Aligned Chunks - Several Per Thread So Stealing Can Balance The Load
+  const auto _T0 = std::chrono::steady_clock::now();
+  size_t _target = _SIZE / (_threads * 16U);
+  if (_target < (1U << 20)) _target = 1U << 20;  // At Least 1.MB Per Chunk
+  size_t _pos = 0;
+  while (_pos < _SIZE) {
+    size_t _end = _pos + _target;
+    if (_end >= _SIZE) _end = _SIZE;
+    else {
+      const char* _nl = (const char*)memchr(_data + _end, '\n', _SIZE - _end);
+      _end = _nl ? (size_t)(_nl - _data) + 1 : _SIZE; // End After The New Line
+    }
+    Chunk _c = {_data + _pos, _end - _pos, NULL, 0, 0, false};
+    _chunks.push_back(_c);
+    _pos = _end;
+  }
+
+  // Deal The Chunks Round Robin To The Workers
+  for (unsigned _t = 0; _t < _threads; _t++) _queues.emplace_back();
+  for (size_t _i = 0; _i < _chunks.size(); _i++) _queues[_i % _threads]._chunks.push_back(_i);
+  std::vector<std::thread> _pool;
+  for (unsigned _t = 0; _t < _threads; _t++) _pool.push_back(std::thread(worker, (size_t)_t));
+
+  // Write The Chunks In Order
+  uint64_t _lines = 0;
+  bool _ok = true;
+  for (size_t _i = 0; _i < _chunks.size(); _i++) {
+    {
+      std::unique_lock<std::mutex> _guard(_doneLock);
+      while (!_chunks[_i]._done && !_failed) _doneSignal.wait(_guard);
+    }
+    if (_failed) break;                          // Out Of Memory - Write No More
+    if (fwrite(_chunks[_i]._out, 1, _chunks[_i]._outLen, _out) != _chunks[_i]._outLen) {
+      perror(argv[optind + 1]);                  // The Output Failed - Disk Full Or Gone
+      _ok = false;
+      _failed = true;                            // Stop The Workers
+      break;
+    }
+    _lines += _chunks[_i]._lines + (_chunks[_i]._inLen && _chunks[_i]._in[_chunks[_i]._inLen - 1] != '\n');
+    free(_chunks[_i]._out);                      // Done With This Buffer
+    _chunks[_i]._out = NULL;
+  }
+  for (size_t _t = 0; _t < _pool.size(); _t++) _pool[_t].join();
+  if (_failed) {                                 // Clean Up & Give Up
+    for (size_t _i = 0; _i < _chunks.size(); _i++) free(_chunks[_i]._out);
+    fclose(_out);
+    remove(argv[optind + 1]);                    // No Half Written Output
+    if (_ok) fprintf(stderr, "out of memory\n"); // Else The Write Error Is Printed
+    return 1;
+  }
+  if (fclose(_out) != 0) _ok = false;
+  if (!_ok) { perror(argv[optind + 1]); return 1; }
+  if (_data) munmap((void*)_data, _SIZE);
+  close(_IN);
+
+  // Report The Throughput
+  const double _SECONDS = std::chrono::duration<double>(std::chrono::steady_clock::now() - _T0).count();
+  fprintf(stderr, "%llu lines, %.1f MB in %.3f s: %.1f MB/s, %.0f lines/s (%u threads)\n",
+          (unsigned long long)_lines, _SIZE / 1e6, _SECONDS,
+          _SECONDS > 0 ? _SIZE / 1e6 / _SECONDS : 0.0, _SECONDS > 0 ? _lines / _SECONDS : 0.0, _threads);
+  return 0;
+}
+
+
+// End Of File.
@@ -0,0 +1,557 @@
+//
+//    FILE: DateTimeTests.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Host (Linux) tool. Checks of the library that need no board - run it after every change.
+//   Build: g++ -O1 -g -std=c++11 -fsanitize=address,undefined -I../../src DateTimeTests.cpp ../../src/*.cpp -o DateTimeTests
+//    -||-: Add -mssse3 (x86) so the iso test also runs the SSE ISO 8601 parser.
+//   Usage: DateTimeTests [test ...]     (No test = All, exit code 0 = All passed)
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// How it works:
+// Each test is a function that counts its failed checks, CHECK() prints the line of each one.
+// The tests are listed in _TESTS_ & run in that order, or only the ones named on the command line.
+// Build it with the sanitizers, then a write or read past a buffer fails the run as well.
+
+#include <DateTimeClock.h>                       // Include The DateTimeClock Library
+#include <DateTimeIntervals.h>                   // Include The DateTimeIntervals Library
+#include <DateTimeRecur.h>                       // Include The DateTimeRecur Library
+#include <DateTimeRing.h>                        // Include The DateTimeRing Library
+
+#include <stdlib.h>
+#include <string.h>
+
+// Check A Condition - Counts & Prints The Failures
+static uint32_t _fails = 0;                      // Failed Checks In This Test
+#define CHECK(c) do { if (!(c)) { _fails++; fprintf(stderr, "  %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #c); } } while (0)
+
+// Days Since 01/01/1970 From A Date & Back - Reference For The Library Kernels (H. Hinnant)
+static int64_t refDays(int64_t _y, const uint32_t _M, const uint32_t _D) {
+  _y -= (_M <= 2);
+  const int64_t _ERA = (_y >= 0 ? _y : _y - 399) / 400;
+  const uint32_t _YOE = (uint32_t)(_y - _ERA * 400);
+  const uint32_t _DOY = (153 * (_M > 2 ? _M - 3 : _M + 9) + 2) / 5 + _D - 1;
+  return _ERA * 146097 + _YOE * 365 + _YOE / 4 - _YOE / 100 + _DOY - 719468;
+}
+static void refDate(int64_t _z, int64_t& _y, uint32_t& _m, uint32_t& _d) {
+  _z += 719468;
+  const int64_t _ERA = (_z >= 0 ? _z : _z - 146096) / 146097;
+  const uint32_t _DOE = (uint32_t)(_z - _ERA * 146097);
+  const uint32_t _YOE = (_DOE - _DOE / 1460 + _DOE / 36524 - _DOE / 146096) / 365;
+  const uint32_t _DOY = _DOE - (365 * _YOE + _YOE / 4 - _YOE / 100);
+  const uint32_t _MP = (5 * _DOY + 2) / 153;
+  _d = _DOY - (153 * _MP + 2) / 5 + 1;
+  _m = _MP < 10 ? _MP + 3 : _MP - 9;
+  _y = (int64_t)_YOE + _ERA * 400 + (_m <= 2);
+}
+
+// FNV-1a Digest Of Results - Same Value From Both Profiles
+static uint64_t _digest = 0xCBF29CE484222325ULL; // Digest State
+static void mix(const void* _DATA, const size_t _LEN) {
+  for (size_t _i = 0; _i < _LEN; _i++) { _digest ^= ((const uint8_t*)_DATA)[_i]; _digest *= 0x100000001B3ULL; }
+}
+static void mix(const uint64_t _V) { mix(&_V, sizeof(_V)); }
+
+// Small Random Numbers - Same On Every Run
+static uint64_t _seed = 0x9E3779B97F4A7C15ULL;   // Random State
+static uint64_t rnd() {
+  _seed ^= _seed << 13; _seed ^= _seed >> 7; _seed ^= _seed << 17; // xorshift64
+  return _seed;
+}
+
+
+//--------------------- Clock ---------------------//
+
+// DateTimeClock Across The 32.bit Tick Wrap - millis(), micros() & 32768.Hz Style Sources
+static void testClock() {
+  const uint64_t _SYNC = 1700000000000ULL;       // Unix Milliseconds At The Sync
+  // millis() - Start 5.s Before The Wrap & Run Past It Twice, Reading At Random Gaps
+  DateTimeClock::setMockTicks(0xFFFFFFFFUL - 5000UL);
+  DateTimeClock _ms(DateTimeClock::mockTicks, 1000UL);
+  _ms.sync((uint32_t)(_SYNC / 1000ULL), (uint16_t)(_SYNC % 1000ULL));
+  uint64_t _elapsed = 0, _last = _ms.nowMillis();
+  CHECK(_last == _SYNC);
+  while (_elapsed < 9000000000ULL) {             // 2.1 Wraps
+    const uint32_t _STEP = (rnd() % 256U) ? (uint32_t)(rnd() % 100000UL) : (uint32_t)(rnd() % 2000000000UL); // loop() Or Now & Then A Long Gap
+    DateTimeClock::setMockTicks(DateTimeClock::mockTicks() + _STEP);
+    _elapsed += _STEP;
+    const uint64_t _NOW = _ms.nowMillis();
+    CHECK(_NOW >= _last);                        // Monotonic
+    CHECK(_NOW == _SYNC + _elapsed);             // No Drift Set - Exact
+    CHECK(_ms.now() == (uint32_t)(_NOW / 1000ULL));
+    _last = _NOW;
+    if (_fails > 10) return;                     // Enough Output
+  }
+
+  // micros() - Wraps Every 71.min, Read At Least Once Per Wrap
+  DateTimeClock::setMockTicks(0xFFFFFFFFUL - 3000000UL);
+  DateTimeClock _us(DateTimeClock::mockTicks, 1000000UL);
+  _us.sync((uint32_t)(_SYNC / 1000ULL), 0);
+  uint64_t _usElapsed = 0;
+  _last = _us.nowMillis();
+  for (uint32_t _i = 0; _i < 20000; _i++) {
+    const uint32_t _STEP = (uint32_t)(rnd() % 4000000000UL);
+    DateTimeClock::setMockTicks(DateTimeClock::mockTicks() + _STEP);
+    _usElapsed += _STEP;
+    const uint64_t _NOW = _us.nowMillis();
+    CHECK(_NOW >= _last);
+    CHECK(_NOW == _SYNC + _usElapsed / 1000ULL);
+    _last = _NOW;
+    if (_fails > 10) return;
+  }
+
+  // Drift Set - Still Monotonic Across The Wrap & 100.ppm Fast
+  DateTimeClock::setMockTicks(0xFFFFFFFFUL - 1000UL);
+  DateTimeClock _dr(DateTimeClock::mockTicks, 1000UL);
+  _dr.sync((uint32_t)(_SYNC / 1000ULL), 0);
+  _dr.setDrift(100000L);
+  _elapsed = 0;
+  _last = _dr.nowMillis();
+  for (uint32_t _i = 0; _i < 100000; _i++) {
+    const uint32_t _STEP = (uint32_t)(rnd() % 100000UL);
+    DateTimeClock::setMockTicks(DateTimeClock::mockTicks() + _STEP);
+    _elapsed += _STEP;
+    const uint64_t _NOW = _dr.nowMillis();
+    CHECK(_NOW >= _last);
+    const int64_t _ERROR = (int64_t)(_NOW - _SYNC) - (int64_t)(_elapsed + _elapsed / 10000ULL);
+    CHECK(_ERROR >= -1 && _ERROR <= 1);
+    _last = _NOW;
+    if (_fails > 10) return;
+  }
+
+  // 32768.Hz - Not A Multiple Of 1000, Read Every 33 Ticks. No Part Millisecond May Be Lost
+  DateTimeClock::setMockTicks(0xFFFFFFFFUL - 100000UL);
+  DateTimeClock _xt(DateTimeClock::mockTicks, 32768UL);
+  _xt.sync((uint32_t)(_SYNC / 1000ULL), 0);
+  uint64_t _ticks = 0;
+  for (uint32_t _i = 0; _i < 100000; _i++) {     // 100.7.s
+    DateTimeClock::setMockTicks(DateTimeClock::mockTicks() + 33UL);
+    _ticks += 33ULL;
+    CHECK(_xt.nowMillis() == _SYNC + _ticks * 1000ULL / 32768ULL);
+    if (_fails > 10) return;
+  }
+  // The Crystal Is 20.ppm Fast - sync() After 1.hour Measures -20000.ppb, Then The Clock Follows The Real Time
+  _xt.sync((uint32_t)(_SYNC / 1000ULL), 0);      // Time Was Set - New Reference
+  _ticks = 0;
+  for (uint8_t _hour = 0; _hour < 2; _hour++) {
+    while (_ticks * 100000000ULL < (_hour + 1ULL) * 3600000ULL * 3276865536ULL) { // Real Milliseconds = Ticks / 32.76865536
+      DateTimeClock::setMockTicks(DateTimeClock::mockTicks() + 33UL);
+      _ticks += 33ULL;
+      _xt.nowMillis();
+    }
+    const uint64_t _REAL = _SYNC + _ticks * 100000000ULL / 3276865536ULL; // Real Unix Milliseconds
+    if (_hour == 0) {
+      _xt.sync((uint32_t)(_REAL / 1000ULL), (uint16_t)(_REAL % 1000ULL));
+      CHECK(_xt.getDrift() >= -20500L && _xt.getDrift() <= -19500L);
+    }
+    else {
+      const int64_t _ERROR = (int64_t)(_xt.nowMillis() - _REAL);
+      CHECK(_ERROR >= -3 && _ERROR <= 3);
+    }
+  }
+}
+
+
+//--------------------- Epoch ---------------------//
+
+// GPS & Excel - The Array Calls Match The Single Calls & Times Before The Epoch Are Clamped
+static void testEpoch() {
+  DateTimeFunctions _dTF;
+  // GPS Single & Array Agree, Both Ways
+  uint64_t _gps[64];
+  int64_t _ut[64];
+  uint64_t _back[64];
+  for (uint8_t _i = 0; _i < 64; _i++) _gps[_i] = rnd() % (3000ULL * 604800ULL);
+  _dTF.conEpoch2UT(DATETIMEFUNCTIONS_EPOCH_GPS, _gps, _ut, 64);
+  _dTF.conUT2Epoch(DATETIMEFUNCTIONS_EPOCH_GPS, _ut, _back, 64);
+  for (uint8_t _i = 0; _i < 64; _i++) {
+    CHECK(_ut[_i] == _dTF.conGPS2UT((uint16_t)(_gps[_i] / 604800ULL), (uint32_t)(_gps[_i] % 604800ULL)));
+    CHECK(_back[_i] == _gps[_i]);
+  }
+  CHECK(_dTF.conGPS2UT(0, 18) == 315964800LL);   // 06/01/1980 - 00:00:00 UTC
+  // GPS Before 06/01/1980 & Past Week 65535 Is Clamped
+  uint16_t _week = 1;
+  uint32_t _tow = 1;
+  CHECK(_dTF.conUT2GPS(315964800LL - 18LL, _week, _tow) && _week == 0 && _tow == 0);
+  CHECK(!_dTF.conUT2GPS(315964800LL - 19LL, _week, _tow) && _week == 0 && _tow == 0);
+  CHECK(!_dTF.conUT2GPS(0LL, _week, _tow) && _week == 0 && _tow == 0);
+  CHECK(!_dTF.conUT2GPS(315964800LL + 65536LL * 604800LL, _week, _tow) && _week == 65535U && _tow == 604799UL);
+  const int64_t _EARLY[3] = {0LL, -86400LL, INT64_MIN};
+  _dTF.conUT2Epoch(DATETIMEFUNCTIONS_EPOCH_GPS, _EARLY, _back, 3);
+  CHECK(_back[0] == 0 && _back[1] == 0 && _back[2] == 0);
+  // GPS Arrays Are Not Cut To A 16.bit Week - The Last Second Of Week 65535 & On
+  const uint64_t _LASTWEEK = 65536ULL * 604800ULL;   // First Second Of Week 65536
+  const uint64_t _WIDE[4] = {_LASTWEEK - 1ULL, _LASTWEEK, _LASTWEEK + 12345ULL, 1000000ULL * 604800ULL};
+  _dTF.conEpoch2UT(DATETIMEFUNCTIONS_EPOCH_GPS, _WIDE, _ut, 4);
+  _dTF.conUT2Epoch(DATETIMEFUNCTIONS_EPOCH_GPS, _ut, _back, 4);
+  CHECK(_ut[0] == _dTF.conGPS2UT(65535U, 604799UL));
+  for (uint8_t _i = 0; _i < 4; _i++) {
+    CHECK(_ut[_i] == _ut[0] + (int64_t)(_WIDE[_i] - _WIDE[0]));
+    CHECK(_back[_i] == _WIDE[_i]);
+  }
+  // Excel Before 01/01/1900 Is Clamped To 0
+  CHECK(_dTF.conUT2Excel(-2208988800LL) == 1UL);  // 01/01/1900
+  CHECK(_dTF.conUT2Excel(-2208988801LL) == 0UL);  // 31/12/1899 = Excel Day 0
+  CHECK(_dTF.conUT2Excel(-2208988800LL - 86401LL) == 0UL);
+  CHECK(_dTF.conUT2Excel(-62135596800LL) == 0UL);
+  CHECK(_dTF.conUT2Excel(0LL) == 25569UL);       // 01/01/1970
+  _dTF.conUT2Epoch(DATETIMEFUNCTIONS_EPOCH_EXCEL, _EARLY, _back, 2);
+  CHECK(_back[0] == 25569ULL && _back[1] == 25568ULL);
+}
+
+
+//------------------- Duration --------------------//
+
+// conISO2Ms() - Valid Durations, Totals That Do Not Fit In 64.bits & Strings Past 255 Characters
+static void testDuration() {
+  DateTimeFunctions _dTF;
+  uint64_t _ms = 0;
+  CHECK(_dTF.conISO2Ms("P1Y2DT3H4M5.5S", _ms) && _ms == 31536000000ULL + 2ULL * 86400000ULL + 3ULL * 3600000ULL + 4ULL * 60000ULL + 5500ULL);
+  CHECK(_dTF.conISO2Ms("PT0S", _ms) && _ms == 0);
+  CHECK(!_dTF.conISO2Ms("P", _ms));
+  CHECK(!_dTF.conISO2Ms("P1M", _ms));            // Months Have No Fixed Length
+  CHECK(!_dTF.conISO2Ms("P1000000000000D", _ms)); // 13.Digits
+  // One Part To Big
+  CHECK(!_dTF.conISO2Ms("P999999999999Y", _ms));
+  CHECK(!_dTF.conISO2Ms("P999999999999W", _ms));
+  CHECK(!_dTF.conISO2Ms("P999999999999D", _ms));
+  CHECK(_dTF.conISO2Ms("PT999999999999H", _ms) && _ms == 3599999999996400000ULL); // Fits - 3.6e18
+  // Right On The Limit - The Sum Of The Parts
+  CHECK(_dTF.conISO2Ms("P584942417Y", _ms) && _ms == 18446744062512000000ULL);
+  CHECK(!_dTF.conISO2Ms("P584942418Y", _ms));
+  CHECK(_dTF.conISO2Ms("P584942417Y129DT14H25M51.615S", _ms) && _ms == 0xFFFFFFFFFFFFFFFFULL);
+  CHECK(!_dTF.conISO2Ms("P584942417Y129DT14H25M51.616S", _ms)); // 1.ms Over
+  CHECK(!_dTF.conISO2Ms("P584942417Y130D", _ms));
+  // Longer Than 255 Characters - A Long Fraction, Only The First 3 Digits Count
+  char _long[320] = "PT1.";
+  memset(_long + 4, '0', 300);
+  strcpy(_long + 304, "9S");
+  CHECK(_dTF.conISO2Ms(_long, _ms) && _ms == 1000ULL);
+  _long[304] = 'x';
+  CHECK(!_dTF.conISO2Ms(_long, _ms));
+}
+
+
+//---------------------- ISO ----------------------//
+
+// conISO2UT() - Every Cut Of A Timestamp In A Buffer Of Its Own Size, So A Read Past The End Is Caught
+static void testISO() {
+  DateTimeFunctions _dTF;
+  const char* _FULL[] = {"2023-11-14T22:13:20Z", "2023-11-14T22:13:20.250Z", "2023-11-14T22:13:20.123456789Z"};
+  for (uint8_t _f = 0; _f < 3; _f++) {
+    const size_t _LEN = strlen(_FULL[_f]);
+    for (size_t _cut = 0; _cut <= _LEN; _cut++) {
+      char* _str = (char*)malloc(_cut + 1);      // Exact Size - No Slack For The Loads
+      memcpy(_str, _FULL[_f], _cut);
+      _str[_cut] = '\0';
+      uint64_t _ut = 0;
+      uint16_t _ms = 0;
+      const bool _OK = _dTF.conISO2UT(_str, _ut, _ms);
+      CHECK(_OK == (_cut == _LEN));
+      if (_OK) CHECK(_ut == 1700000000ULL && _ms == (_f == 0 ? 0 : _f == 1 ? 250 : 123));
+      free(_str);
+    }
+  }
+  // The Array Call With Short & Long Strings
+  const char* _IN[4] = {"1970-01-01T00:00:00Z", "", "2038-01-19T03:14:08Z", "2038-01-19"};
+  uint64_t _out[4];
+  uint32_t _mask = 0;
+  CHECK(_dTF.conISO2UT(_IN, _out, 4, &_mask) == 2 && _mask == 5UL && _out[0] == 0 && _out[2] == 2147483648ULL);
+}
+
+
+//--------------------- Recur ---------------------//
+
+// DateTimeRecur - A Lone Sign Is Not A Number & nextAfter() With COUNT Matches Walking With next()
+static void testRecur() {
+  DateTimeRecur _rule;
+  const uint64_t _START = 1704103200ULL;         // 01/01/2024 - 10:00:00, A Monday
+  CHECK(_rule.begin("FREQ=MONTHLY;BYDAY=-1FR", _START));
+  CHECK(_rule.begin("FREQ=MONTHLY;BYDAY=+2TU", _START));
+  CHECK(!_rule.begin("FREQ=MONTHLY;BYDAY=+MO", _START));
+  CHECK(!_rule.begin("FREQ=MONTHLY;BYDAY=-MO", _START));
+  CHECK(!_rule.begin("FREQ=MONTHLY;BYMONTHDAY=-", _START));
+  CHECK(!_rule.begin("FREQ=MONTHLY;BYMONTHDAY=1,+", _START));
+  CHECK(!_rule.begin("FREQ=DAILY;COUNT=+", _START));
+  CHECK(!_rule.begin("FREQ=YEARLY;BYSETPOS=-;BYDAY=MO", _START));
+  // nextAfter() Against next() - COUNT Runs Out Many Periods In, UNTIL Inside A Counted Period
+  const char* _RULES[] = {"FREQ=DAILY;INTERVAL=3;COUNT=500", "FREQ=WEEKLY;BYDAY=MO,WE,FR;COUNT=900",
+                          "FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=1,-1;COUNT=400",
+                          "FREQ=YEARLY;BYMONTH=2;BYMONTHDAY=29;COUNT=20", "FREQ=WEEKLY;BYDAY=SA,SU;COUNT=300;UNTIL=20250315"};
+  for (uint8_t _r = 0; _r < sizeof(_RULES) / sizeof(_RULES[0]); _r++) {
+    uint64_t _all[1000];
+    uint16_t _n = 0;
+    CHECK(_rule.begin(_RULES[_r], _START));
+    while (_n < 1000 && _rule.next(_all[_n])) _n++;
+    for (uint16_t _i = 0; _i < 200; _i++) {
+      const uint64_t _T = _START - 86400ULL + rnd() % (_all[_n - 1] - _START + 2ULL * 86400ULL);
+      uint16_t _want = 0;
+      while (_want < _n && _all[_want] <= _T) _want++;
+      uint64_t _next = 0;
+      const bool _OK = _rule.nextAfter(_T, _next);
+      CHECK(_OK == (_want < _n) && (!_OK || _next == _all[_want]));
+      if (_OK && _want + 1U < _n) CHECK(_rule.next(_next) && _next == _all[_want + 1U]);
+    }
+  }
+}
+
+
+//--------------------- Grid ----------------------//
+
+// grid2Str() - Today In The First Column Is Marked & No Row Ends In A Space
+static void testGrid() {
+  DateTimeFunctions _dTF;
+  DateTimeMonthGrid _grid;
+  char _text[DATETIMEFUNCTIONS_GRID_TEXT];
+  _dTF.getMonthGrid(1, 2024, _grid, true, 1);    // 01/01/2024 Is A Monday - Column 0
+  CHECK(strcmp(_dTF.grid2Str(_text, _grid, false),
+               " January 2024\n Mo Tu We Th Fr Sa Su\n* 1  2  3  4  5  6  7\n  8  9 10 11 12 13 14\n"
+               " 15 16 17 18 19 20 21\n 22 23 24 25 26 27 28\n 29 30 31\n") == 0);
+  CHECK(strcmp(_dTF.grid2Str(_text, _grid, true),
+               " January 2024\nWk Mo Tu We Th Fr Sa Su\n01* 1  2  3  4  5  6  7\n02  8  9 10 11 12 13 14\n"
+               "03 15 16 17 18 19 20 21\n04 22 23 24 25 26 27 28\n05 29 30 31\n") == 0);
+  _dTF.getMonthGrid(12, 2024, _grid, false, 29); // 29/12/2024 Is A Sunday - Column 0, Last Row
+  CHECK(strcmp(_dTF.grid2Str(_text, _grid, false),
+               " December 2024\n Su Mo Tu We Th Fr Sa\n  1  2  3  4  5  6  7\n  8  9 10 11 12 13 14\n"
+               " 15 16 17 18 19 20 21\n 22 23 24 25 26 27 28\n*29 30 31\n") == 0);
+  // Every Month Of 2000-2030, Both Layouts - Today Marked Once & No Space Before A New Line
+  for (uint16_t _year = 2000; _year <= 2030; _year++) {
+    for (uint8_t _month = 1; _month <= 12; _month++) {
+      const uint8_t _TODAY = 1 + (uint8_t)(rnd() % _dTF.getDIM(_month, _year));
+      _dTF.getMonthGrid(_month, _year, _grid, (_year & 1) != 0, _TODAY);
+      for (uint8_t _weeks = 0; _weeks < 2; _weeks++) {
+        _dTF.grid2Str(_text, _grid, _weeks != 0);
+        CHECK(strstr(_text, " \n") == NULL);
+        const char* _STAR = strchr(_text, '*');
+        CHECK(_STAR && strchr(_STAR + 1, '*') == NULL && atoi(_STAR + 1) == _TODAY);
+      }
+    }
+  }
+}
+
+
+//------------------- Intervals -------------------//
+
+// nextTransition() Across The End Of The Period - Only Leaving At The Seam Skips Ahead
+static void testIntervals() {
+  uint32_t _next = 0;
+  DateTimeIntervals _day(DATETIMEINTERVALS_DAY);
+  CHECK(_day.addDaily(0, 0, 0, 6, 0, 0));         // 00:00-06:00
+  CHECK(_day.nextTransition(43200, _next) && _next == 86400UL);   // Out - In Again At Midnight
+  CHECK(_day.nextTransition(3600, _next) && _next == 21600UL);    // In - Out At 06:00
+  CHECK(_day.nextTransition(86400UL + 43200UL, _next) && _next == 2UL * 86400UL); // The Next Day
+  CHECK(_day.addDaily(22, 0, 0, 6, 0, 0));        // 22:00-06:00 - Over Midnight
+  CHECK(_day.nextTransition(43200, _next) && _next == 79200UL);   // Out - In At 22:00
+  CHECK(_day.nextTransition(80000, _next) && _next == 86400UL + 21600UL); // In Over Midnight - Out At 06:00
+  CHECK(_day.nextTransition(0, _next) && _next == 21600UL);
+  DateTimeIntervals _week(DATETIMEINTERVALS_WEEK);
+  CHECK(_week.add(0, 100));
+  CHECK(_week.nextTransition(5000, _next) && _next == 10080UL);   // Out - The Next Interval Starts At 0
+  CHECK(_week.nextTransition(50, _next) && _next == 100UL);
+  CHECK(_week.add(200, 300));
+  CHECK(_week.nextTransition(400, _next) && _next == 10080UL);    // Outside All Intervals - The Next Starts At 0
+  CHECK(_week.nextTransition(10080UL + 150UL, _next) && _next == 10080UL + 200UL);
+  CHECK(_week.add(10000, 50) && _week.getCount() == 3);           // Wraps Into [0, 100)
+  CHECK(_week.nextTransition(10050, _next) && _next == 10080UL + 100UL); // In Over The Seam - Out At 100
+  CHECK(_week.nextTransition(5000, _next) && _next == 10000UL);
+  CHECK(!_week.add(10080, 10090) && !_week.add(20000, 5) && _week.getCount() == 3); // Start Not In The Period
+  DateTimeIntervals _all(DATETIMEINTERVALS_DAY);
+  CHECK(_all.add(0, DATETIMEINTERVALS_DAY) && !_all.nextTransition(1000, _next)); // The Whole Period - Never Changes
+}
+
+
+//--------------------- Ring ----------------------//
+
+// Print Sink Into A String - Keeps What Was Written
+class StringPrint : public Print {
+  public:
+    StringPrint() : _len(0) { _text[0] = '\0'; }
+    size_t write(uint8_t _c) { if (_len + 1 >= sizeof(_text)) return 0; _text[_len++] = (char)_c; _text[_len] = '\0'; return 1; }
+    using Print::write;
+    char _text[512];                             // Written Text
+    size_t _len;                                 // Characters Written
+};
+
+// Value Printer For printRange()
+static size_t printValue(Print& _out, const uint16_t& _VALUE) {
+  char _text[8];
+  snprintf(_text, sizeof(_text), "%u", _VALUE);
+  return _out.write(_text);
+}
+
+// printRange() - The Count Includes The Characters Of The Value Printer
+static void testRing() {
+  DateTimeRing<uint16_t, 8> _ring;
+  for (uint16_t _i = 0; _i < 12; _i++) _ring.push(1700000000ULL + _i * 60ULL, (uint16_t)(_i * 111U));
+  StringPrint _with, _without;
+  const size_t _N = _ring.printRange(_with, 1700000240ULL, 1700000420ULL, false, printValue); // Entries 4, 5 & 6
+  CHECK(_N == _with._len);
+  CHECK(strstr(_with._text, " 444\n") && strstr(_with._text, " 555\n") && strstr(_with._text, " 666\n") && !strstr(_with._text, " 777"));
+  const size_t _M = _ring.printRange(_without, 1700000240ULL, 1700000420ULL);
+  CHECK(_M == _without._len);
+  CHECK(_N == _M + 3U * 4U);                     // " 444" ...
+}
+
+
+//-------------------- Format ---------------------//
+
+// Batch conUT2DT() - A Buffer Of Exactly The Right Size Takes All, One Byte Less Drops The Last
+static void testFormat() {
+  DateTimeFunctions _dTF;
+  const uint16_t _N = 4;
+  uint64_t _in[_N];
+  uint32_t _offsets[_N + 1];
+  char _one[DATETIMEFUNCTIONS_FORMAT_MAX + 1];
+  // ISO - 20 Characters Each, n * 20 + (n - 1) Separators + The Null = 21 * n
+  for (uint16_t _i = 0; _i < _N; _i++) _in[_i] = 1700000000ULL + _i * 50000ULL; // Some Share A Day
+  for (uint8_t _less = 0; _less < 2; _less++) {
+    const uint32_t _SIZE = 21U * _N - _less;
+    char* _out = (char*)malloc(_SIZE);           // Exact Size - A Write Past The End Is Caught
+    const uint16_t _DONE = _dTF.conUT2DT(DATETIMEFUNCTIONS_FORMAT_ISO, _in, _out, _N, _SIZE, ',', _offsets);
+    CHECK(_DONE == _N - _less && strlen(_out) == 21U * _DONE - 1U);
+    for (uint16_t _i = 0; _i <= _DONE; _i++) CHECK(_offsets[_i] == 21U * _i - (_i == _DONE ? 1U : 0U));
+    free(_out);
+  }
+  // Years Past 9999 Are One Wider Than getFormatWidth() - 22 Characters Each
+  CHECK(_dTF.getFormatWidth(DATETIMEFUNCTIONS_FORMAT_DATETIME) == 21);
+  for (uint16_t _i = 0; _i < _N; _i++) _in[_i] = 253402300800ULL + _i * 90061ULL; // 01/01/10000 On
+  for (uint8_t _pass = 0; _pass < 2; _pass++) {
+    const uint32_t _SIZE = _pass ? 23U * _N - 1U : (uint32_t)_N * (DATETIMEFUNCTIONS_FORMAT_MAX + 1U);
+    char* _out = (char*)malloc(_SIZE);
+    const uint16_t _DONE = _dTF.conUT2DT(DATETIMEFUNCTIONS_FORMAT_DATETIME, _in, _out, _N, _SIZE, ',');
+    CHECK(_pass ? _DONE < _N : _DONE == _N);
+    // The Same Text As One conUT2DT() Per Timestamp
+    char _want[_N * (DATETIMEFUNCTIONS_FORMAT_MAX + 1)] = "";
+    for (uint16_t _i = 0; _i < _DONE; _i++) {
+      if (_i > 0) strcat(_want, ",");
+      strcat(_want, _dTF.conUT2DT(_one, _in[_i]));
+    }
+    CHECK(strcmp(_out, _want) == 0 && strlen(_out) == 23U * _DONE - (_DONE ? 1U : 0U));
+    free(_out);
+  }
+}
+
+
+//-------------------- Profile --------------------//
+
+// SMALL & FAST Kernels - Checked Against The Reference & Put In A Digest For profiles.sh
+static void testProfile() {
+  DateTimeFunctions _dTF;
+  const uint64_t _LAST = (uint64_t)refDays(65536, 1, 1) * 86400ULL - 1ULL; // 31/12/65535 - 23:59:59
+  // Edge Times - Epoch, Leap Days, Century Years, The 2^39 Fast Path Limit & The Last Second
+  const uint64_t _EDGES[] = {0ULL, 59ULL, 86399ULL, 86400ULL, 951782399ULL, 951782400ULL, 951868800ULL,
+                             4107456000ULL, 4107542399ULL, 4107542400ULL, 4294967295ULL, 4294967296ULL,
+                             253402300799ULL, 253402300800ULL, (1ULL << 39) - 1ULL, 1ULL << 39, (1ULL << 39) + 1ULL,
+                             _LAST - 86400ULL, _LAST};
+  const uint32_t _EDGECOUNT = sizeof(_EDGES) / sizeof(_EDGES[0]);
+  const uint32_t _CASES = 1000000;               // Random Cases After The Edges
+  char _str[32];
+  _digest = 0xCBF29CE484222325ULL;
+  _seed = 0x9E3779B97F4A7C15ULL;                 // Same Cases Whatever Ran Before
+  for (uint32_t _n = 0; _n < _EDGECOUNT + _CASES && _fails < 10; _n++) {
+    uint64_t _t;
+    if (_n < _EDGECOUNT) _t = _EDGES[_n];
+    else if (_n & 1) _t = rnd() % 4294967296ULL; // Mostly 32.bit Unix Time
+    else _t = rnd() % (_LAST + 1ULL);            // Any Year
+    // Split - UT2F
+    uint8_t _day, _month, _hour, _min, _sec;
+    uint16_t _year;
+    _dTF.conUT2DT(_t, _day, _month, _year, _hour, _min, _sec);
+    int64_t _ry; uint32_t _rm, _rd;
+    refDate((int64_t)(_t / 86400ULL), _ry, _rm, _rd);
+    CHECK(_year == _ry && _month == _rm && _day == _rd);
+    CHECK((uint32_t)_hour * 3600UL + _min * 60UL + _sec == _t % 86400ULL);
+    mix(_year); mix(_month); mix(_day); mix(_hour); mix(_min); mix(_sec);
+    // Day Kernels - DFC
+    const uint64_t _DAYS = _t / 86400ULL;
+    CHECK(_dTF.getDOW(_day, _month, _year) == (_DAYS + 4ULL) % 7ULL);
+    CHECK(_dTF.getDOY(_day, _month, _year) == _DAYS - refDays(_year, 1, 1) + 1);
+    mix(_dTF.getWOY(_day, _month, _year));
+    uint32_t _ut = 0;
+    if (_t < 4294967296ULL) CHECK(_dTF.conDT2UT(_day, _month, _year, _hour, _min, _sec, _ut) && _ut == _t);
+    // Strings - Every Date Format & Setting
+    const uint32_t _R = (uint32_t)rnd();
+    _dTF.setDFormat(1 + (_R & 3U));
+    _dTF.setCFormat((_R >> 2) & 1U);
+    _dTF.setDZero((_R >> 3) & 1U);
+    _dTF.setHZero((_R >> 4) & 1U);
+    _dTF.conUT2DT(_str, _t, (_R >> 5) & 1U);
+    mix(_str, strlen(_str));
+    // Periods - PFL
+    const uint8_t _PERIOD = (uint8_t)((_R >> 6) % 7U);
+    const int32_t _OFFSET = (int32_t)((_R >> 9) % 100801U) - 50400L; // -14.h ... +14.h
+    const uint64_t _FLOOR = _dTF.floorTo(_t, _PERIOD, _OFFSET);
+    const uint64_t _CEIL = _dTF.ceilTo(_t, _PERIOD, _OFFSET);
+    const uint64_t _ORIGIN = rnd() % (_t + 1ULL);
+    const int32_t _BUCKET = _dTF.bucketIndex(_t, _PERIOD, _ORIGIN, _OFFSET);
+    if ((int64_t)_t + _OFFSET >= 86400LL * 366LL && _t + 86400ULL * 366ULL < _LAST) { // Whole Periods In Range
+      CHECK(_FLOOR <= _t && _CEIL >= _t);
+      const int64_t _LOCAL = (int64_t)_t + _OFFSET;
+      int64_t _ly; uint32_t _lm, _ld;
+      refDate(_LOCAL / 86400, _ly, _lm, _ld);
+      int64_t _want = -1;                        // Reference Floor In Local Seconds
+      if (_PERIOD == DATETIMEFUNCTIONS_PERIOD_MINUTE) _want = _LOCAL - _LOCAL % 60;
+      else if (_PERIOD == DATETIMEFUNCTIONS_PERIOD_HOUR) _want = _LOCAL - _LOCAL % 3600;
+      else if (_PERIOD == DATETIMEFUNCTIONS_PERIOD_DAY) _want = _LOCAL - _LOCAL % 86400;
+      else if (_PERIOD == DATETIMEFUNCTIONS_PERIOD_WEEK) _want = (_LOCAL / 86400 - (_LOCAL / 86400 + 3) % 7) * 86400;
+      else if (_PERIOD == DATETIMEFUNCTIONS_PERIOD_MONTH) _want = refDays(_ly, _lm, 1) * 86400;
+      else if (_PERIOD == DATETIMEFUNCTIONS_PERIOD_QUARTER) _want = refDays(_ly, _lm - (_lm - 1) % 3, 1) * 86400;
+      else _want = refDays(_ly, 1, 1) * 86400;
+      CHECK((int64_t)_FLOOR == _want - _OFFSET);
+    }
+    mix(_FLOOR); mix(_CEIL); mix((uint64_t)(int64_t)_BUCKET);
+  }
+  // Array Formatter & Roman Numerals
+  uint64_t _in[64];
+  char _out[64 * 27 + 1];
+  for (uint8_t _f = 0; _f <= DATETIMEFUNCTIONS_FORMAT_ISO; _f++) {
+    for (uint8_t _i = 0; _i < 64; _i++) _in[_i] = rnd() % 253402300800ULL;
+    mix(_dTF.conUT2DT(_f, _in, _out, 64, sizeof(_out)));
+    mix(_out, strlen(_out));
+  }
+  for (uint16_t _i = 1; _i < 4000; _i++) { const char* _ROMAN = _dTF.conNum2Roman(_i); mix(_ROMAN, strlen(_ROMAN)); }
+  fprintf(stderr, "  profile %s digest %016llx\n", DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST ? "FAST" : "SMALL",
+          (unsigned long long)_digest);
+}
+
+
+//--------------------- Main ----------------------//
+
+// All Tests
+struct Test {
+  const char* _name;                             // Name On The Command Line
+  void (*_run)();                                // The Test
+};
+static const Test _TESTS_[] = {
+  {"clock", testClock},
+  {"epoch", testEpoch},
+  {"duration", testDuration},
+  {"iso", testISO},
+  {"recur", testRecur},
+  {"grid", testGrid},
+  {"intervals", testIntervals},
+  {"ring", testRing},
+  {"format", testFormat},
+  {"profile", testProfile},
+};
+
+
+int main(int argc, char** argv) {
+  uint32_t _failed = 0, _ran = 0;                // Tests Failed & Run
+  for (size_t _t = 0; _t < sizeof(_TESTS_) / sizeof(_TESTS_[0]); _t++) {
+    bool _wanted = (argc < 2);                   // No Names = All
+    for (int _a = 1; _a < argc; _a++) if (strcmp(argv[_a], _TESTS_[_t]._name) == 0) _wanted = true;
+    if (!_wanted) continue;
+    _fails = 0;
+    _TESTS_[_t]._run();
+    fprintf(stderr, "%-10s %s\n", _TESTS_[_t]._name, _fails ? "FAIL" : "ok");
+    _failed += (_fails != 0);
+    _ran++;
+  }
+  fprintf(stderr, "%u of %u tests passed\n", _ran - _failed, _ran);
+  return (_failed || !_ran) ? 1 : 0;
+}
+
+
+// End Of File.
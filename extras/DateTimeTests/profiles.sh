@@ -0,0 +1,35 @@
+#!/bin/sh
+#
+#    FILE: profiles.sh
+#  AUTHOR: XbergCode
+# VERSION: 1.0.0
+# PURPOSE: Host (Linux) tool. Builds DateTimeTests with the SMALL & the FAST profile, runs both
+#    -||-: & checks that the profile test gives the same digest, so both profiles give the same results.
+#   Usage: ./profiles.sh     (Exit code 0 = Same results & all tests passed)
+#     URL: https://github.com/XbergCode/DateTimeFunctions
+#
+
+cd "$(dirname "$0")" || exit 2
+OUT=$(mktemp -d) || exit 2
+trap 'rm -rf "$OUT"' EXIT
+
+FAIL=0
+SIMD=""
+case "$(uname -m)" in x86_64|i?86) SIMD="-mssse3" ;; esac # Run The SSE ISO 8601 Parser Too
+for PROFILE in 0 1; do                           # 0 = SMALL & 1 = FAST
+  g++ -O1 -g -std=c++11 -fsanitize=address,undefined $SIMD -DDATETIMEFUNCTIONS_PROFILE=$PROFILE \
+      -I../../src DateTimeTests.cpp ../../src/*.cpp -o "$OUT/DateTimeTests$PROFILE" || exit 2
+  "$OUT/DateTimeTests$PROFILE" 2> "$OUT/log$PROFILE" || FAIL=1
+  cat "$OUT/log$PROFILE" >&2
+done
+
+# Same Digest From Both Profiles
+SMALL=$(sed -n 's/.*digest \([0-9a-f]*\).*/\1/p' "$OUT/log0")
+FAST=$(sed -n 's/.*digest \([0-9a-f]*\).*/\1/p' "$OUT/log1")
+if [ -z "$SMALL" ] || [ "$SMALL" != "$FAST" ]; then
+  echo "profiles differ: SMALL $SMALL, FAST $FAST" >&2
+  FAIL=1
+else
+  echo "profiles match: $SMALL" >&2
+fi
+exit $FAIL
@@ -0,0 +1,84 @@
+//
+//    FILE: DateTimeBoundary.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Period boundary tracker for DateTimeFunctions. Tells the main loop when the minute, hour, day ... changed.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+#include "DateTimeBoundary.h"                     // Include The DateTimeBoundary Header
+
+// How it works:
+// For each boundary that is tracked the start of the next period is kept (from ceilTo()), and so is
+// the time it was all worked out from (_from) & how long it is from there to the soonest one (_span).
+// update() works out (time - _from) < _span, one unsigned compare: it is true until the soonest
+// boundary is reached, and false when the time went back before _from (it wraps). Only then are the
+// levels that were passed worked out again, and a level is crossed when its next boundary changed.
+
+// Period Of Each Level For ceilTo() - The Second Has None
+static const uint8_t DATETIMEBOUNDARY_PERIOD[7] = {
+  0, DATETIMEFUNCTIONS_PERIOD_MINUTE, DATETIMEFUNCTIONS_PERIOD_HOUR, DATETIMEFUNCTIONS_PERIOD_DAY,
+  DATETIMEFUNCTIONS_PERIOD_WEEK, DATETIMEFUNCTIONS_PERIOD_MONTH, DATETIMEFUNCTIONS_PERIOD_YEAR
+};
+
+
+//---------------------- Set ----------------------//
+
+// Set The Class Object Name - DateTimeBoundary(mask, offset) - _OFFSET Is The Time Zone In Seconds (+3600 = UTC+1)
+DateTimeBoundary::DateTimeBoundary(const uint8_t _MASK, const int32_t _OFFSET) {
+  _mask   = _MASK & DATETIMEBOUNDARY_ALL;         // Set The Boundaries
+  _offset = _OFFSET;                              // Set The Time Zone
+  _begun  = false;                                // Not Begun
+  _from   = 0;                                    // No Time
+  _span   = 0;                                    // Work It Out On The First update()
+}
+
+// Start From A Time - begin(unixTime)
+void DateTimeBoundary::begin(const uint64_t _UNIXTIME) {
+  NXT(_UNIXTIME, true);                           // Work Out All Boundaries
+  _begun = true;                                  // Begun
+}
+
+
+//---------------------- Get ----------------------//
+
+// Get The Boundaries Crossed Since The Last Call - update(unixTime) = Returns: DATETIMEBOUNDARY_... Bits, 0 = None
+uint8_t DateTimeBoundary::update(const uint64_t _UNIXTIME) {
+  // Minute & day changed = DATETIMEBOUNDARY_MINUTE | DATETIMEBOUNDARY_HOUR | DATETIMEBOUNDARY_DAY & so on.
+  // The first call without begin() starts from the time & returns 0. A time that went back
+  // returns the boundaries whose period changed.
+  if (_UNIXTIME - _from < _span) return 0;                                  // Nothing Crossed - The Common Case
+  if (!_begun) { begin(_UNIXTIME); return 0; }                              // First Call
+  return NXT(_UNIXTIME, _UNIXTIME < _from);                                 // Work Out The Passed Boundaries
+}
+
+// Get The Next Boundary - getNext() = Returns: Unix Time Of The Soonest Tracked Boundary, 0 = None
+uint64_t DateTimeBoundary::getNext() {
+  return _mask ? _from + _span : 0ULL;                                      // Return The Soonest
+}
+
+
+//-------------------- Private --------------------//
+
+// Work Out The Next Boundaries - _ALL: All Levels, Else Only The Ones Passed - Returns: The Boundaries That Changed
+uint8_t DateTimeBoundary::NXT(const uint64_t _UNIXTIME, const bool _ALL) {
+  uint8_t _crossed = 0;                                                     // Boundaries Crossed
+  uint64_t _soonest = 0xFFFFFFFFFFFFFFFFULL;                                // Soonest Boundary
+  for (uint8_t _i = 0; _i < 7; _i++) {
+    if (!((_mask >> _i) & 1U)) continue;                                    // Not Tracked
+    if (_ALL || !_begun || _UNIXTIME >= _next[_i]) {                        // Work It Out
+      const uint64_t _N = (_i == 0) ? _UNIXTIME + 1ULL : _dTF.ceilTo(_UNIXTIME + 1ULL, DATETIMEBOUNDARY_PERIOD[_i], _offset); // Start Of The Next Period
+      if (_begun && _N != _next[_i]) _crossed |= 1U << _i;                  // Another Period - Crossed
+      _next[_i] = _N;                                                       // Set The Next Boundary
+    }
+    if (_next[_i] < _soonest) _soonest = _next[_i];                         // Soonest Boundary
+  }
+  _from = _UNIXTIME;                                                        // Worked Out From
+  _span = _soonest - _UNIXTIME;                                             // To The Soonest - Never Reached If Nothing Is Tracked
+  return _crossed;                                                          // Return The Boundaries Crossed
+}
+
+// End Of File.
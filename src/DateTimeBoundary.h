@@ -0,0 +1,45 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeBoundary.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Period boundary tracker for DateTimeFunctions. Tells the main loop when the minute, hour, day ... changed.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// Include
+#include "DateTimeFunctions.h"                       // Include The DateTimeFunctions Library
+
+// Boundaries - Bits Returned By update()
+#define DATETIMEBOUNDARY_SECOND 0x01                 // New Second
+#define DATETIMEBOUNDARY_MINUTE 0x02                 // New Minute
+#define DATETIMEBOUNDARY_HOUR   0x04                 // New Hour
+#define DATETIMEBOUNDARY_DAY    0x08                 // New Day
+#define DATETIMEBOUNDARY_WEEK   0x10                 // New ISO Week - Monday
+#define DATETIMEBOUNDARY_MONTH  0x20                 // New Month
+#define DATETIMEBOUNDARY_YEAR   0x40                 // New Year
+#define DATETIMEBOUNDARY_ALL    0x7F                 // All Of Them
+
+
+class DateTimeBoundary {
+  public:                                            // Public
+    // Set
+    DateTimeBoundary(const uint8_t _MASK = DATETIMEBOUNDARY_ALL, const int32_t _OFFSET = 0);                            // Set The Class Object Name - Boundaries To Track & Time Zone In Seconds
+    void begin(const uint64_t _UNIXTIME);                                                                               // Start From A Time - Nothing Crossed
+    // Get
+    uint8_t update(const uint64_t _UNIXTIME);                                                                           // Get The Boundaries Crossed Since The Last Call
+    uint64_t getNext();                                                                                                 // Get The Next Boundary - Unix Time
+
+  private:                                           // Private
+    uint64_t _next[7];                               // Next Boundary Of Each Level
+    uint64_t _from;                                  // Time The Boundaries Were Worked Out From
+    uint64_t _span;                                  // From _from To The Next Boundary
+    int32_t _offset;                                 // Time Zone In Seconds
+    uint8_t _mask;                                   // Boundaries Tracked
+    bool _begun;                                     // begin() Done
+    DateTimeFunctions _dTF;                          // Date Functions
+    // Work Out The Next Boundaries - Returns: The Boundaries That Changed
+    uint8_t NXT(const uint64_t _UNIXTIME, const bool _ALL);
+};
+
+// End Of File.
@@ -0,0 +1,201 @@
+//
+//    FILE: DateTimeBusiness.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Business day calendar for DateTimeFunctions. Count working days and find the next working day.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+#include "DateTimeBusiness.h"                     // Include The DateTimeBusiness Header
+
+// How it works:
+// Each year is made into a 366.bit set (12 x 32.bit words) of the days that are not business days:
+// the weekend days, the fixed holidays, the Easter holidays and the nth weekday holidays. It is made
+// once and kept in a small cache. Counting is then popcount on whole words, and the next business day
+// skips whole words, so a range of many years costs a few words per year and not a loop per day.
+
+// Rule Types
+#define DATETIMEBUSINESS_FIXED  0                 // Same Date Every Year
+#define DATETIMEBUSINESS_EASTER 1                 // Days From Easter Sunday
+#define DATETIMEBUSINESS_NTH    2                 // Nth Weekday Of Month
+
+
+//---------------------- Set ----------------------//
+
+// Set The Class Object Name
+DateTimeBusiness::DateTimeBusiness() {
+  _ruleCount = 0;                                 // No Holidays
+  _weekend   = DATETIMEBUSINESS_WEEKEND;          // Saturday & Sunday
+  _bitsValid = 0;                                 // No Bitsets
+  _bitsNext  = 0;                                 // First Bitset
+}
+
+// Set The Weekend Days - setWeekend(mask) - Bit 0 = Sunday ... Bit 6 = Saturday, 0x41 = Saturday & Sunday
+void DateTimeBusiness::setWeekend(const uint8_t _DOWMASK) {
+  _weekend = _DOWMASK & 0x7F;                     // Set The Weekend Days
+  _bitsValid = 0;                                 // Make The Bitsets Again
+}
+
+// Add A Holiday - addFixed(day, month) = Returns: true If Added "0-1"
+bool DateTimeBusiness::addFixed(const uint8_t _DAY, const uint8_t _MONTH) {
+  // Same Date Every Year - 29/02 Is Only Used In Leap Years
+  if (_MONTH < 1 || _MONTH > 12 || _DAY < 1 || _DAY > _dTF.getDIM(_MONTH, 2000U)) return false; // Wrong Date
+  return ADR(DATETIMEBUSINESS_FIXED, _DAY, _MONTH, 0);                      // Add The Rule
+}
+
+// Add A Holiday - addEaster(offset) = Returns: true If Added "0-1"
+bool DateTimeBusiness::addEaster(const int8_t _OFFSET) {
+  // Days From Easter Sunday: -2 = Good Friday, 1 = Easter Monday, 39 = Ascension, 50 = Whit Monday
+  return ADR(DATETIMEBUSINESS_EASTER, _OFFSET, 0, 0);                       // Add The Rule
+}
+
+// Add A Holiday - addNthWeekday(nth, dow, month) = Returns: true If Added "0-1"
+bool DateTimeBusiness::addNthWeekday(const int8_t _NTH, const uint8_t _DOW, const uint8_t _MONTH) {
+  // Nth Weekday Of Month: _NTH = 1-5 Or -1 = Last & _DOW = 0-6 "Sun-Sat"
+  // 5 is only used in the months that have a 5th one.
+  if ((_NTH < 1 || _NTH > 5) && _NTH != -1) return false;                   // Wrong Nth
+  if (_DOW > 6 || _MONTH < 1 || _MONTH > 12) return false;                  // Wrong Weekday Or Month
+  return ADR(DATETIMEBUSINESS_NTH, _NTH, _DOW, _MONTH);                     // Add The Rule
+}
+
+// Remove All Holidays - clearRules()
+void DateTimeBusiness::clearRules() {
+  _ruleCount = 0;                                 // No Holidays
+  _bitsValid = 0;                                 // Make The Bitsets Again
+}
+
+
+//--------------------- Check ---------------------//
+
+// Check For Business Day - isBusinessDay(day, month, year) = Returns: true If Business Day "0-1"
+bool DateTimeBusiness::isBusinessDay(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  const uint32_t* _BITS = GYB(_YEAR);                                       // Year Bitset
+  const uint16_t _I = _dTF.getDOY(_DAY, _MONTH, _YEAR) - 1U;                // Bit Index
+  return !((_BITS[_I >> 5] >> (_I & 31U)) & 1UL);                           // Bit Not Set = Business Day
+}
+
+
+//---------------------- Get ----------------------//
+
+// Get Business Days Between Date - getBusinessDays(day1, month1, year1, day2, month2, year2) = Returns: 0-4294967295
+uint32_t DateTimeBusiness::getBusinessDays(const uint8_t _DAY1, const uint8_t _MONTH1, const uint16_t _YEAR1, const uint8_t _DAY2, const uint8_t _MONTH2, const uint16_t _YEAR2) {
+  // Business Days Between Date - Date 1 Is Counted, Date 2 Is Not. 0 If Date 2 Is Not After Date 1.
+  uint16_t _from = _dTF.getDOY(_DAY1, _MONTH1, _YEAR1) - 1U;                // First Bit In Year 1
+  const uint16_t _TO = _dTF.getDOY(_DAY2, _MONTH2, _YEAR2) - 1U;            // Last Bit In Year 2 (Not Counted)
+  if (_YEAR2 < _YEAR1 || (_YEAR2 == _YEAR1 && _TO <= _from)) return 0UL;    // Wrong Order
+  uint32_t _days = 0UL;                                                     // Business Days
+  for (uint16_t _year = _YEAR1; ; _year++) {
+    const uint16_t _END = (_year == _YEAR2) ? _TO : _dTF.getDIY(_year);    // End Of The Range In This Year
+    if (_END > _from) _days += (_END - _from) - CSB(GYB(_year), _from, _END); // Days - Not Business Days
+    if (_year == _YEAR2) break;                                             // Done
+    _from = 0U;                                                             // Next Year From 01/01
+  }
+  return _days;                                                             // Return The Business Days
+}
+
+// Get The Business Day N Business Days After Date - getNextBusinessDay(day, month, year, N, day, month, year) = Returns: true If Found "0-1"
+bool DateTimeBusiness::getNextBusinessDay(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint32_t _N, uint8_t& _day, uint8_t& _month, uint16_t& _year) {
+  // Business Day N Business Days After Date
+  // N = 0 gives the date itself if it is a business day, else the next business day.
+  // N = 1 gives the first business day after the date, and so on. False if no weekday is a business day.
+  if (_weekend == 0x7F) return false;                                       // No Business Days
+  uint16_t _i = _dTF.getDOY(_DAY, _MONTH, _YEAR) - 1U;                      // Bit Index
+  uint32_t _need = _N;                                                      // Business Days Left To Find
+  if (_N == 0UL) _need = 1UL;                                               // The Date Itself Counts
+  else _i++;                                                                // Start The Day After
+  for (uint16_t _y = _YEAR; ; _y++) {
+    const uint32_t* _BITS = GYB(_y);                                        // Year Bitset - Days After 31/12 Are Set
+    for (uint8_t _w = _i >> 5; _w < 12; _w++) {
+      uint32_t _free = ~_BITS[_w];                                          // Business Days In The Word
+      if (_w == (_i >> 5)) _free &= 0xFFFFFFFFUL << (_i & 31U);             // Only From _i
+      const uint8_t _COUNT = __builtin_popcountl(_free);                    // Business Days In The Word
+      if (_need > _COUNT) { _need -= _COUNT; continue; }                    // Skip The Word
+      while (--_need > 0UL) _free &= _free - 1UL;                           // Drop The Lower Business Days
+      const uint16_t _DOY = (_w << 5) + __builtin_ctzl(_free) + 1U;        // Day Of Year
+      _day = _dTF.conDOY2D(_DOY, _y);                                       // Set The Day
+      _month = _dTF.conDOY2M(_DOY, _y);                                     // Set The Month
+      _year = _y;                                                           // Set The Year
+      return true;                                                          // Found
+    }
+    if (_y == 65535U) return false;                                         // Out Of Years
+    _i = 0U;                                                                // Next Year From 01/01
+  }
+}
+
+// Add A Rule - Private - Returns: true If Added "0-1"
+bool DateTimeBusiness::ADR(const uint8_t _TYPE, const int8_t _A, const uint8_t _B, const uint8_t _C) {
+  if (_ruleCount >= DATETIMEBUSINESS_MAX_RULES) return false;               // No Room
+  _rules[_ruleCount]._type = _TYPE;                                         // Set The Type
+  _rules[_ruleCount]._a = _A;                                               // Set The Day, Offset Or Nth
+  _rules[_ruleCount]._b = _B;                                               // Set The Month Or Weekday
+  _rules[_ruleCount]._c = _C;                                               // Set The Month
+  _ruleCount++;                                                             // One More Rule
+  _bitsValid = 0;                                                           // Make The Bitsets Again
+  return true;                                                              // Added
+}
+
+// Get The Year Bitset - Private - Returns: 12 Words, Bit Set = Not A Business Day
+const uint32_t* DateTimeBusiness::GYB(const uint16_t _YEAR) {
+  // Cached
+  for (uint8_t _c = 0; _c < DATETIMEBUSINESS_CACHE; _c++)
+    if ((_bitsValid >> _c) & 1U && _bitsYear[_c] == _YEAR) return _bits[_c]; // Found In The Cache
+
+  // Make The Bitset - Replace The Oldest
+  uint32_t* _b = _bits[_bitsNext];                                          // Bitset To Fill
+  _bitsYear[_bitsNext] = _YEAR;                                             // Set The Year
+  _bitsValid |= 1U << _bitsNext;                                            // Mark Built
+  _bitsNext = (_bitsNext + 1U) % DATETIMEBUSINESS_CACHE;                    // Next To Replace
+  const uint16_t _DIY = _dTF.getDIY(_YEAR);                                 // Days In Year
+  // Weekends - One Week Pattern, Moved Along By The Weekday Of 01/01
+  uint8_t _dow = _dTF.getDOW(1, 1, _YEAR);                                  // Weekday Of Bit 0
+  for (uint8_t _w = 0; _w < 12; _w++) {
+    uint32_t _word = 0UL;                                                   // Word Bits
+    for (uint8_t _bit = 0; _bit < 32; _bit++) {
+      if ((_weekend >> _dow) & 1U) _word |= 1UL << _bit;                    // Weekend Day
+      if (++_dow == 7) _dow = 0;                                            // Next Weekday
+    }
+    _b[_w] = _word;                                                         // Set The Word
+  }
+  // Days After 31/12 Are Not Business Days
+  _b[11] |= 0xFFFFFFFFUL << (_DIY - 352U);                                  // Bits 365 Or 366 ... 383
+  // Holidays
+  uint8_t _eDay = 0, _eMonth = 0;                                           // Easter Sunday
+  for (uint8_t _r = 0; _r < _ruleCount; _r++) {
+    int16_t _doy = 0;                                                       // Day Of Year Of The Holiday
+    const Rule& _RULE = _rules[_r];                                         // The Rule
+    if (_RULE._type == DATETIMEBUSINESS_FIXED) {                            // Same Date Every Year
+      if (_RULE._b == 2 && _RULE._a == 29 && _DIY == 365U) continue;        // No 29/02 This Year
+      _doy = _dTF.getDOY(_RULE._a, _RULE._b, _YEAR);                        // Day Of Year
+    }
+    else if (_RULE._type == DATETIMEBUSINESS_EASTER) {                      // Days From Easter Sunday
+      if (_eMonth == 0) _dTF.getEaster(_YEAR, _eDay, _eMonth);              // Get Easter Once
+      _doy = _dTF.getDOY(_eDay, _eMonth, _YEAR) + _RULE._a;                 // Day Of Year
+    }
+    else {                                                                  // Nth Weekday Of Month
+      const uint8_t _mday = _dTF.nthWeekdayOfMonth(_RULE._a, _RULE._b, _RULE._c, _YEAR); // Day Of Month
+      if (_mday == 0) continue;                                             // No 5th This Month
+      _doy = _dTF.getDOY(_mday, _RULE._c, _YEAR);                           // Day Of Year
+    }
+    if (_doy < 1 || _doy > (int16_t)_DIY) continue;                         // Not In This Year
+    _b[(_doy - 1) >> 5] |= 1UL << ((_doy - 1) & 31);                        // Not A Business Day
+  }
+  return _b;                                                                // Return The Bitset
+}
+
+// Count The Set Bits - Private - Returns: Set Bits From _FROM To _TO (Not Included)
+uint16_t DateTimeBusiness::CSB(const uint32_t* _BITS, const uint16_t _FROM, const uint16_t _TO) {
+  uint16_t _count = 0U;                                                     // Set Bits
+  const uint8_t _FIRST = _FROM >> 5, _LAST = (_TO - 1U) >> 5;               // First & Last Word
+  for (uint8_t _w = _FIRST; _w <= _LAST; _w++) {
+    uint32_t _word = _BITS[_w];                                             // Word Bits
+    if (_w == _FIRST) _word &= 0xFFFFFFFFUL << (_FROM & 31U);               // Only From _FROM
+    if (_w == _LAST && (_TO & 31U) != 0U) _word &= 0xFFFFFFFFUL >> (32U - (_TO & 31U)); // Only Up To _TO
+    _count += __builtin_popcountl(_word);                                   // Count The Bits
+  }
+  return _count;                                                            // Return The Count
+}
+
+// End Of File.
@@ -0,0 +1,59 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeBusiness.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Business day calendar for DateTimeFunctions. Count working days and find the next working day.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// Include
+#include "DateTimeFunctions.h"                       // Include The DateTimeFunctions Library
+
+// Settings
+#define DATETIMEBUSINESS_MAX_RULES 16                // Max Holiday Rules - 4.bytes Each
+#define DATETIMEBUSINESS_CACHE     4                 // Years Kept As Bitsets - 50.bytes Each
+#define DATETIMEBUSINESS_WEEKEND   0x41              // Default Weekend: Bit 0 = Sunday ... Bit 6 = Saturday
+
+
+class DateTimeBusiness {
+  public:                                            // Public
+    // Set
+    DateTimeBusiness();                                                                                                 // Set The Class Object Name
+    void setWeekend(const uint8_t _DOWMASK);                                                                            // Set The Weekend Days - Bit 0 = Sunday ... Bit 6 = Saturday
+    bool addFixed(const uint8_t _DAY, const uint8_t _MONTH);                                                            // Add A Holiday - Same Date Every Year
+    bool addEaster(const int8_t _OFFSET);                                                                               // Add A Holiday - Days From Easter Sunday
+    bool addNthWeekday(const int8_t _NTH, const uint8_t _DOW, const uint8_t _MONTH);                                    // Add A Holiday - Nth Weekday Of Month (-1 = Last)
+    void clearRules();                                                                                                  // Remove All Holidays
+    // Check
+    bool isBusinessDay(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);                                 // Check For Business Day
+    // Get
+    uint32_t getBusinessDays(const uint8_t _DAY1, const uint8_t _MONTH1, const uint16_t _YEAR1, const uint8_t _DAY2, const uint8_t _MONTH2, const uint16_t _YEAR2); // Get Business Days Between Date
+    bool getNextBusinessDay(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint32_t _N, uint8_t& _day, uint8_t& _month, uint16_t& _year); // Get The Business Day N Business Days After Date
+
+  private:                                           // Private
+    // Holiday Rule
+    struct Rule {
+      uint8_t _type;                                 // Rule Type: 0 = Fixed & 1 = Easter & 2 = Nth Weekday
+      int8_t _a;                                     // Day, Easter Offset Or Nth
+      uint8_t _b;                                    // Month Or Day Of Week
+      uint8_t _c;                                    // Month (Nth Weekday)
+    };
+    Rule _rules[DATETIMEBUSINESS_MAX_RULES];         // Holiday Rules
+    uint8_t _ruleCount;                              // Holiday Rules Added
+    uint8_t _weekend;                                // Weekend Days
+    // Year Bitsets - Bit Set = Not A Business Day, Bit 0 Of Word 0 = 01/01
+    uint32_t _bits[DATETIMEBUSINESS_CACHE][12];      // 384.bits Per Year
+    uint16_t _bitsYear[DATETIMEBUSINESS_CACHE];      // Year Of Each Bitset
+    uint8_t _bitsValid;                              // Bitset Is Built - One Bit Per Bitset
+    uint8_t _bitsNext;                               // Next Bitset To Replace
+    DateTimeFunctions _dTF;                          // Date Functions
+    // Add A Rule
+    bool ADR(const uint8_t _TYPE, const int8_t _A, const uint8_t _B, const uint8_t _C);
+    // Get The Year Bitset - Builds It If It Is Not Cached
+    const uint32_t* GYB(const uint16_t _YEAR);
+    // Count The Set Bits From _FROM To _TO (Not Included)
+    static uint16_t CSB(const uint32_t* _BITS, const uint16_t _FROM, const uint16_t _TO);
+};
+
+// End Of File.
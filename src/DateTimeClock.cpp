@@ -0,0 +1,178 @@
+//
+//    FILE: DateTimeClock.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Software clock for DateTimeFunctions. Sync it now and then from RTC or NTP and read the time from a tick source.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+#include "DateTimeClock.h"                        // Include The DateTimeClock Header
+#if !defined(ARDUINO)                             // Host Build
+  #include <time.h>                               // clock_gettime()
+#endif
+
+// Drift Limits
+#define DATETIMECLOCK_MAX_DRIFT   500000L         // Max Drift Rate = 500.ppm (Parts Per Billion)
+#define DATETIMECLOCK_MAX_STEP    60000LL         // Sync Error Above 60.sec Is A Step, Not Drift (Milliseconds)
+#define DATETIMECLOCK_MIN_REF     600000ULL       // Measure The Drift Over 10.min Or More (Milliseconds)
+#define DATETIMECLOCK_MAX_REF     604800000ULL    // Start A New Drift Reference After 7.days (Milliseconds)
+
+// Mock Tick Counter
+uint32_t DateTimeClock::_mockTicks = 0UL;         // Mock Ticks
+
+
+//---------------------- Set ----------------------//
+
+// Set The Tick Source - DateTimeClock(millis, 1000) Or DateTimeClock(micros, 1000000)
+DateTimeClock::DateTimeClock(uint32_t (*_TICKSOURCE)(), const uint32_t _TICKSPERSEC) {
+  _tickSource  = _TICKSOURCE;                     // Tick Source
+  _ticksPerSec = _TICKSPERSEC;                    // Ticks Per Second
+  _anchorTicks = 0UL;                             // Ticks Already Counted
+  _rest        = 0UL;                             // Ticks * 1000 Below One Millisecond
+  _syncMillis  = 0ULL;                            // Unix Milliseconds At The Last Sync
+  _raw         = 0ULL;                            // Raw Milliseconds Since The Last Sync
+  _refMillis   = 0ULL;                            // Unix Milliseconds At The Drift Reference
+  _refRaw      = 0ULL;                            // Raw Milliseconds From The Drift Reference
+  _drift       = 0L;                              // No Drift
+  _lastSync    = 0UL;                             // Never Synced
+  _synced      = false;                           // Not Synced
+}
+
+// Sync The Clock - sync(unixTime, milliseconds) - From RTC Or NTP
+void DateTimeClock::sync(const uint32_t _UNIXTIME, const uint16_t _MILLIS) {
+  // Sync The Clock
+  // The time between two syncs is compared to the ticks that went by, that gives the drift rate
+  // of the tick source. It is measured over a long reference (10.min to 7.days), so a RTC that
+  // only gives whole seconds still ends up with a good rate.
+  const uint64_t _ACTUAL = (uint64_t)_UNIXTIME * 1000ULL + _MILLIS;         // The Real Time
+  if (_synced) {                                                            // We Have A Sync To Compare With
+    const int64_t _ERROR = (int64_t)(_ACTUAL - MTA());                      // Real Time - Clock Time
+    const uint64_t _RAW = _refRaw + _raw;                                   // Raw Milliseconds Since The Reference
+    if (_ERROR > DATETIMECLOCK_MAX_STEP || _ERROR < -DATETIMECLOCK_MAX_STEP) { // Time Was Set - New Reference
+      _refMillis = _ACTUAL;                                                 // New Reference
+      _refRaw = 0ULL;                                                       // Reset The Raw Milliseconds
+    }
+    else {                                                                  // Measure The Drift
+      _refRaw = _RAW;                                                       // Raw Milliseconds Since The Reference
+      if (_RAW >= DATETIMECLOCK_MIN_REF) {                                  // Long Enough To Measure
+        const int64_t _OFF = (int64_t)(_ACTUAL - _refMillis) - (int64_t)_RAW; // Real - Raw Milliseconds
+        _drift = LTD(_OFF * 1000000000LL / (int64_t)_RAW);                  // Set The Drift Rate
+      }
+      if (_RAW >= DATETIMECLOCK_MAX_REF) {                                  // Reference Is Old - Follow Temperature Changes
+        _refMillis = _ACTUAL;                                               // New Reference
+        _refRaw = 0ULL;                                                     // Reset The Raw Milliseconds
+      }
+    }
+  }
+  else {                                                                    // First Sync
+    _anchorTicks = _tickSource();                                           // Start Counting Ticks
+    _rest = 0UL;                                                            // No Part Millisecond
+    _refMillis = _ACTUAL;                                                   // First Reference
+    _refRaw = 0ULL;                                                         // Reset The Raw Milliseconds
+  }
+  _syncMillis = _ACTUAL;                                                    // Unix Milliseconds At The Sync
+  _raw = 0ULL;                                                              // Reset The Raw Milliseconds
+  _lastSync = _UNIXTIME;                                                    // Unix Time Of The Last Sync
+  _synced = true;                                                           // Synced
+}
+
+// Set The Drift Rate - setDrift(ppb) - Restore A Saved getDrift() After Reboot
+void DateTimeClock::setDrift(const int32_t _PPB) {
+  // Set The Drift Rate - Parts Per Billion. 1000 = 1.ppm = 86.4.ms per day
+  _drift = LTD(_PPB);                                                       // Set The Drift Rate
+}
+
+
+//--------------------- Check ---------------------//
+
+// Check If The Clock Is Synced - isSynced() = Returns: true If Synced "0-1"
+bool DateTimeClock::isSynced() {
+  return _synced;                                                           // Return Synced
+}
+
+
+//---------------------- Get ----------------------//
+
+// Get The Unix Time - now() = Returns: Seconds Elapsed Since 01/01/1970 - 00:00:00 UTC Or 0 If Not Synced
+uint32_t DateTimeClock::now() {
+  // Get The Unix Time - Seconds
+  return MTA() / 1000ULL;                                                   // Return The Seconds
+}
+
+// Get The Unix Time - nowMillis() = Returns: Milliseconds Elapsed Since 01/01/1970 - 00:00:00 UTC Or 0 If Not Synced
+uint64_t DateTimeClock::nowMillis() {
+  // Get The Unix Time - Milliseconds
+  return MTA();                                                             // Return The Milliseconds
+}
+
+// Get The Drift Rate - getDrift() = Returns: Parts Per Billion "-500000 ... 500000"
+int32_t DateTimeClock::getDrift() {
+  return _drift;                                                            // Return The Drift Rate
+}
+
+// Get The Unix Time Of The Last Sync - getLastSync() = Returns: Unix Time Or 0 If Not Synced
+uint32_t DateTimeClock::getLastSync() {
+  return _lastSync;                                                         // Return The Last Sync
+}
+
+
+//------------------ Tick Sources -----------------//
+
+// Mock Tick Source - mockTicks() = Returns: The Ticks Set With setMockTicks()
+uint32_t DateTimeClock::mockTicks() {
+  return _mockTicks;                                                        // Return The Mock Ticks
+}
+
+// Set The Mock Ticks - setMockTicks(ticks)
+void DateTimeClock::setMockTicks(const uint32_t _TICKS) {
+  _mockTicks = _TICKS;                                                      // Set The Mock Ticks
+}
+
+#if !defined(ARDUINO)                                                       // Host Build
+// Host Tick Source - hostMillis() = Returns: Monotonic Milliseconds (Wraps Like millis())
+uint32_t DateTimeClock::hostMillis() {
+  struct timespec _ts;                                                      // Time
+  clock_gettime(CLOCK_MONOTONIC, &_ts);                                     // Get The Monotonic Time
+  return (uint32_t)((uint64_t)_ts.tv_sec * 1000ULL + _ts.tv_nsec / 1000000L);
+}
+
+// Host Tick Source - hostMicros() = Returns: Monotonic Microseconds (Wraps Like micros())
+uint32_t DateTimeClock::hostMicros() {
+  struct timespec _ts;                                                      // Time
+  clock_gettime(CLOCK_MONOTONIC, &_ts);                                     // Get The Monotonic Time
+  return (uint32_t)((uint64_t)_ts.tv_sec * 1000000ULL + _ts.tv_nsec / 1000L);
+}
+#endif
+
+
+//-------------------- Private --------------------//
+
+// Move The Anchor Up To Now - Private - Returns: Unix Milliseconds
+uint64_t DateTimeClock::MTA() {
+  // Count the ticks since the last call. The unsigned subtraction is wraparound safe,
+  // as long as the clock is read at least once per tick wrap (millis() = 49.days & micros() = 71.min).
+  // All ticks are counted, the part of a millisecond that is left (in 1/1000 ticks) is kept for the
+  // next call, so a tick rate that is not a multiple of 1000 (32768.Hz) does not run fast.
+  // The drift is put on top of all raw milliseconds since the sync, so no rounding builds up.
+  if (!_synced) return 0ULL;                                                // Not Synced
+  const uint32_t _ELAPSED = _tickSource() - _anchorTicks;                   // Ticks Since The Last Call
+  const uint64_t _SCALED = (uint64_t)_ELAPSED * 1000ULL + _rest;            // Ticks * 1000 Not Yet Counted
+  const uint64_t _MS = _SCALED / _ticksPerSec;                              // Whole Milliseconds
+  _rest = (uint32_t)(_SCALED - _MS * _ticksPerSec);                         // Less Than One Millisecond - Wait For The Next Call
+  _anchorTicks += _ELAPSED;                                                 // Count All The Ticks
+  _raw += _MS;                                                              // Raw Milliseconds Since The Sync
+  return _syncMillis + _raw + (int64_t)_raw * _drift / 1000000000LL;        // Return The Unix Milliseconds
+}
+
+// Limit The Drift Rate - Private - Returns: -500000 ... 500000
+int32_t DateTimeClock::LTD(const int64_t _PPB) {
+  if (_PPB > DATETIMECLOCK_MAX_DRIFT) return DATETIMECLOCK_MAX_DRIFT;       // Max
+  if (_PPB < -DATETIMECLOCK_MAX_DRIFT) return -DATETIMECLOCK_MAX_DRIFT;     // Min
+  return (int32_t)_PPB;                                                     // Return The Drift Rate
+}
+
+
+// End Of File.
@@ -0,0 +1,54 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeClock.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Software clock for DateTimeFunctions. Sync it now and then from RTC or NTP and read the time from a tick source.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// Include
+#include "DateTimeFunctions.h"                       // Include The DateTimeFunctions Library
+
+
+class DateTimeClock {
+  public:                                            // Public
+    // Set
+    DateTimeClock(uint32_t (*_TICKSOURCE)(), const uint32_t _TICKSPERSEC = 1000UL);                                    // Set The Tick Source - millis() & 1000 Or micros() & 1000000
+    void sync(const uint32_t _UNIXTIME, const uint16_t _MILLIS = 0);                                                    // Sync The Clock - From RTC Or NTP
+    void setDrift(const int32_t _PPB);                                                                                  // Set The Drift Rate - Parts Per Billion
+    // Check
+    bool isSynced();                                                                                                    // Check If The Clock Is Synced
+    // Get
+    uint32_t now();                                                                                                     // Get The Unix Time - Seconds
+    uint64_t nowMillis();                                                                                               // Get The Unix Time - Milliseconds
+    int32_t getDrift();                                                                                                 // Get The Drift Rate - Parts Per Billion
+    uint32_t getLastSync();                                                                                             // Get The Unix Time Of The Last Sync
+    // Tick Sources
+    static uint32_t mockTicks();                                                                                        // Mock Tick Source - For Tests
+    static void setMockTicks(const uint32_t _TICKS);                                                                    // Set The Mock Ticks
+    #if !defined(ARDUINO)                                                                                               // Host Build
+    static uint32_t hostMillis();                                                                                       // Host Tick Source - clock_gettime() Milliseconds
+    static uint32_t hostMicros();                                                                                       // Host Tick Source - clock_gettime() Microseconds
+    #endif
+
+  private:                                           // Private
+    uint32_t (*_tickSource)();                       // Tick Source
+    uint32_t _ticksPerSec;                           // Ticks Per Second
+    uint32_t _anchorTicks;                           // Ticks Already Counted
+    uint32_t _rest;                                  // Ticks * 1000 Below One Millisecond - Counted On The Next Call
+    uint64_t _syncMillis;                            // Unix Milliseconds At The Last Sync
+    uint64_t _raw;                                   // Raw (Uncorrected) Milliseconds Since The Last Sync
+    uint64_t _refMillis;                             // Unix Milliseconds At The Drift Reference Sync
+    uint64_t _refRaw;                                // Raw Milliseconds From The Drift Reference To The Last Sync
+    int32_t _drift;                                  // Drift Rate - Parts Per Billion
+    uint32_t _lastSync;                              // Unix Time Of The Last Sync
+    bool _synced;                                    // Clock Is Synced
+    static uint32_t _mockTicks;                      // Mock Tick Counter
+    // Move The Anchor Up To Now - Returns: Unix Milliseconds
+    uint64_t MTA();
+    // Limit The Drift Rate
+    static int32_t LTD(const int64_t _PPB);
+};
+
+// End Of File.
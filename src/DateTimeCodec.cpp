@@ -0,0 +1,227 @@
+//
+//    FILE: DateTimeCodec.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Timestamp codec for DateTimeFunctions. Packs unix time series into blocks with delta of delta bit packing.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+#include "DateTimeCodec.h"                        // Include The DateTimeCodec Header
+
+// How it works:
+// A logger that samples every N seconds writes timestamps whose delta is the same every time,
+// so the delta of the delta (dod) is 0. Each timestamp after the first is stored as its dod:
+//   0                    = '0'                    1.bit   (the same interval again)
+//   -63 ... 64           = '10'   + 7.bits        9.bits
+//   -255 ... 256         = '110'  + 9.bits       12.bits
+//   -2047 ... 2048       = '1110' + 12.bits      16.bits
+//   Else (32.bit signed) = '1111' + 32.bits      36.bits
+// The first timestamp is stored whole in the block header, so every block can be read on its own.
+// Blocks have a fixed size, so block K starts at K * size in the file or flash, and findBlock()
+// can binary search the headers. Block header: first timestamp (8.bytes) & count (2.bytes), little endian.
+
+
+//---------------------- Set ----------------------//
+
+// Set The Class Object Name
+DateTimeCodec::DateTimeCodec() {
+  _block = NULL;                                  // No Block Written
+  _read  = NULL;                                  // No Block Read
+  _size  = 0;                                     // No Block Size
+  _count = 0;                                     // No Timestamps
+  _bit   = 0UL;                                   // Bit Position
+  _last  = 0ULL;                                  // Last Timestamp
+  _delta = 0LL;                                   // Last Delta
+  _first = false;                                 // First Timestamp Read
+}
+
+
+//--------------------- Encode --------------------//
+
+// Start A New Block - begin(block, size) - The Block Is Cleared
+void DateTimeCodec::begin(uint8_t* _BLOCK, const uint16_t _SIZE) {
+  _block = _BLOCK;                                                          // Block To Write
+  _size = _SIZE;                                                            // Block Size
+  _count = 0;                                                               // No Timestamps
+  _bit = DATETIMECODEC_HEADER * 8UL;                                        // Bits Start After The Header
+  memset(_block, 0, _SIZE);                                                 // Clear The Block
+}
+
+// Add A Timestamp - add(unixTime) = Returns: true If Added "0-1"
+bool DateTimeCodec::add(const uint64_t _UNIXTIME) {
+  // False when the block is full: write the block, call begin() and add the timestamp again.
+  if (_block == NULL || _size < DATETIMECODEC_HEADER || _count == 65535U) return false; // No Room
+  if (_count == 0) {                                                        // First Timestamp - Into The Header
+    WLE(_block, _UNIXTIME, 8);                                              // Set The First Timestamp
+    _last = _UNIXTIME;                                                      // Last Timestamp
+    _delta = 0LL;                                                           // No Delta Yet
+  }
+  else {                                                                    // Next Timestamps - Delta Of Delta
+    const int64_t _DELTA = (int64_t)(_UNIXTIME - _last);                    // Delta
+    const int64_t _DOD = (int64_t)((uint64_t)_DELTA - (uint64_t)_delta);    // Delta Of Delta
+    if (_DOD < -2147483647LL - 1LL || _DOD > 2147483647LL) return false;    // Too Big - Start A New Block
+    uint8_t _bits;                                                          // Bits Needed
+    if (_DOD == 0LL) _bits = 1;                                             // '0'
+    else if (_DOD >= -63LL && _DOD <= 64LL) _bits = 9;                      // '10' + 7.bits
+    else if (_DOD >= -255LL && _DOD <= 256LL) _bits = 12;                   // '110' + 9.bits
+    else if (_DOD >= -2047LL && _DOD <= 2048LL) _bits = 16;                 // '1110' + 12.bits
+    else _bits = 36;                                                        // '1111' + 32.bits
+    if (_bit + _bits > _size * 8UL) return false;                           // Block Full
+    if (_bits == 1) WRB(0UL, 1);                                            // Same Interval
+    else if (_bits == 9) WRB((2UL << 7) | (uint32_t)(_DOD + 63LL), 9);      // Small Change
+    else if (_bits == 12) WRB((6UL << 9) | (uint32_t)(_DOD + 255LL), 12);   // Medium Change
+    else if (_bits == 16) WRB((14UL << 12) | (uint32_t)(_DOD + 2047LL), 16); // Big Change
+    else {                                                                  // Any Change
+      WRB(15UL, 4);                                                         // Add The Prefix
+      WRB((uint32_t)_DOD, 32);                                              // Add The Delta Of Delta
+    }
+    _last = _UNIXTIME;                                                      // Last Timestamp
+    _delta = _DELTA;                                                        // Last Delta
+  }
+  _count++;                                                                 // One More Timestamp
+  WLE(_block + 8, _count, 2);                                               // Set The Count
+  return true;                                                              // Added
+}
+
+
+//--------------------- Decode --------------------//
+
+// Open A Block - open(block, size) = Returns: true If Opened "0-1"
+bool DateTimeCodec::open(const uint8_t* _BLOCK, const uint16_t _SIZE) {
+  if (_BLOCK == NULL || _SIZE < DATETIMECODEC_HEADER) return false;         // No Block
+  _read = _BLOCK;                                                           // Block To Read
+  _size = _SIZE;                                                            // Block Size
+  _last = RLE(_BLOCK, 8);                                                   // First Timestamp
+  _count = RLE(_BLOCK + 8, 2);                                              // Timestamps In The Block
+  _bit = DATETIMECODEC_HEADER * 8UL;                                        // Bits Start After The Header
+  _delta = 0LL;                                                             // No Delta Yet
+  _first = true;                                                            // First Timestamp Not Read
+  return true;                                                              // Opened
+}
+
+// Get The Next Timestamp - next(unixTime) = Returns: true If Read "0-1"
+bool DateTimeCodec::next(uint64_t& _unixTime) {
+  if (_read == NULL || _count == 0) return false;                           // No More Timestamps
+  if (!_first) {                                                            // Next Timestamps - Delta Of Delta
+    const uint32_t _END = _size * 8UL;                                      // Bits In The Block
+    int64_t _dod = 0LL;                                                     // Delta Of Delta
+    uint8_t _prefix = 0;                                                    // Prefix '1' Bits
+    while (_prefix < 4) {                                                   // Read The Prefix
+      if (_bit >= _END) return false;                                       // Broken Block
+      if (RDB(1) == 0UL) break;                                             // End Of The Prefix
+      _prefix++;                                                            // One More '1'
+    }
+    if (_prefix > 0) {                                                      // Not The Same Interval
+      const uint8_t _BITS = (_prefix == 1) ? 7 : (_prefix == 2) ? 9 : (_prefix == 3) ? 12 : 32; // Value Bits
+      if (_bit + _BITS > _END) return false;                                // Broken Block
+      const uint32_t _VALUE = RDB(_BITS);                                   // Read The Value
+      if (_prefix == 1) _dod = (int64_t)_VALUE - 63LL;                      // -63 ... 64
+      else if (_prefix == 2) _dod = (int64_t)_VALUE - 255LL;                // -255 ... 256
+      else if (_prefix == 3) _dod = (int64_t)_VALUE - 2047LL;               // -2047 ... 2048
+      else _dod = (int32_t)_VALUE;                                          // 32.bit Signed
+    }
+    _delta = (int64_t)((uint64_t)_delta + (uint64_t)_dod);                  // Delta
+    _last += (uint64_t)_delta;                                              // Timestamp
+  }
+  _first = false;                                                           // First Timestamp Read
+  _count--;                                                                 // One Less Left
+  _unixTime = _last;                                                        // Set The Timestamp
+  return true;                                                              // Read
+}
+
+// Get The Next Timestamp - next(day, month, year, hour, min, sec) = Returns: true If Read "0-1"
+bool DateTimeCodec::next(uint8_t& _day, uint8_t& _month, uint16_t& _year, uint8_t& _hour, uint8_t& _min, uint8_t& _sec) {
+  uint64_t _unixTime;                                                       // Timestamp
+  if (!next(_unixTime)) return false;                                       // No More Timestamps
+  _dTF.conUT2DT(_unixTime, _day, _month, _year, _hour, _min, _sec);         // Split The Timestamp
+  return true;                                                              // Read
+}
+
+// Decode A Whole Block - decodeBlock(block, size, out, max) = Returns: Timestamps Decoded "0-65535"
+uint16_t DateTimeCodec::decodeBlock(const uint8_t* _BLOCK, const uint16_t _SIZE, uint64_t* _out, const uint16_t _MAX) {
+  DateTimeCodec _codec;                                                     // Block Reader
+  if (!_codec.open(_BLOCK, _SIZE)) return 0;                                // No Block
+  uint16_t _n = 0;                                                          // Timestamps Decoded
+  while (_n < _MAX && _codec.next(_out[_n])) _n++;                          // Decode The Timestamps
+  return _n;                                                                // Return The Timestamps Decoded
+}
+
+
+//---------------------- Get ----------------------//
+
+// Get The Timestamps In The Block - getCount() = Returns: Written Or Left To Read "0-65535"
+uint16_t DateTimeCodec::getCount() {
+  return _count;                                                            // Return The Count
+}
+
+// Get The Bytes Used In The Block - getBytes() = Returns: Header & Bits "0-65535"
+uint16_t DateTimeCodec::getBytes() {
+  if (_count == 0 && _read == NULL) return 0;                               // Nothing Written
+  return (_bit + 7UL) / 8UL;                                                // Return The Bytes Used
+}
+
+// Get The Block Header - getBlockInfo(block, first, count) = Returns: true If The Block Has Timestamps "0-1"
+bool DateTimeCodec::getBlockInfo(const uint8_t* _BLOCK, uint64_t& _first, uint16_t& _count) {
+  _first = RLE(_BLOCK, 8);                                                  // First Timestamp
+  _count = RLE(_BLOCK + 8, 2);                                              // Timestamps In The Block
+  return _count > 0;                                                        // Used Block
+}
+
+// Find The Block - findBlock(blocks, blockCount, size, unixTime) = Returns: Block Index "0 ... blockCount - 1"
+uint32_t DateTimeCodec::findBlock(const uint8_t* _BLOCKS, const uint32_t _BLOCKCOUNT, const uint16_t _SIZE, const uint64_t _UNIXTIME) {
+  // The last block that starts at or before the timestamp - Binary search on the headers.
+  // The blocks must be in time order. Empty blocks at the end are skipped.
+  uint32_t _low = 0UL, _high = _BLOCKCOUNT;                                 // Search Range
+  while (_high - _low > 1UL) {
+    const uint32_t _MID = _low + (_high - _low) / 2UL;                      // Middle Block
+    uint64_t _first;                                                        // First Timestamp
+    uint16_t _count;                                                        // Timestamps
+    if (getBlockInfo(_BLOCKS + (uint64_t)_MID * _SIZE, _first, _count) && _first <= _UNIXTIME) _low = _MID; // Go Up
+    else _high = _MID;                                                      // Go Down
+  }
+  return _low;                                                              // Return The Block Index
+}
+
+// Write Bits - Private - MSB First, Into The Cleared Block
+void DateTimeCodec::WRB(const uint32_t _VALUE, const uint8_t _BITS) {
+  uint8_t _left = _BITS;                                                    // Bits Left To Write
+  while (_left > 0) {
+    const uint8_t _ROOM = 8 - (_bit & 7UL);                                 // Free Bits In The Byte
+    const uint8_t _TAKE = (_left < _ROOM) ? _left : _ROOM;                  // Bits Into This Byte
+    const uint8_t _PART = (_VALUE >> (_left - _TAKE)) & ((1U << _TAKE) - 1U); // The Bits
+    _block[_bit >> 3] |= _PART << (_ROOM - _TAKE);                          // Add The Bits
+    _bit += _TAKE;                                                          // Move On
+    _left -= _TAKE;                                                         // Bits Left
+  }
+}
+
+// Read Bits - Private - MSB First
+uint32_t DateTimeCodec::RDB(const uint8_t _BITS) {
+  uint32_t _value = 0UL;                                                    // The Bits
+  uint8_t _left = _BITS;                                                    // Bits Left To Read
+  while (_left > 0) {
+    const uint8_t _HAVE = 8 - (_bit & 7UL);                                 // Unread Bits In The Byte
+    const uint8_t _TAKE = (_left < _HAVE) ? _left : _HAVE;                  // Bits From This Byte
+    _value = (_value << _TAKE) | ((_read[_bit >> 3] >> (_HAVE - _TAKE)) & ((1U << _TAKE) - 1U)); // Add The Bits
+    _bit += _TAKE;                                                          // Move On
+    _left -= _TAKE;                                                         // Bits Left
+  }
+  return _value;                                                            // Return The Bits
+}
+
+// Read Little Endian - Private - Returns: The Value
+uint64_t DateTimeCodec::RLE(const uint8_t* _BYTES, const uint8_t _LEN) {
+  uint64_t _value = 0ULL;                                                   // The Value
+  for (uint8_t _i = _LEN; _i > 0; _i--) _value = (_value << 8) | _BYTES[_i - 1]; // Add The Bytes
+  return _value;                                                            // Return The Value
+}
+
+// Write Little Endian - Private
+void DateTimeCodec::WLE(uint8_t* _bytes, const uint64_t _VALUE, const uint8_t _LEN) {
+  for (uint8_t _i = 0; _i < _LEN; _i++) _bytes[_i] = (uint8_t)(_VALUE >> (_i * 8U)); // Set The Bytes
+}
+
+// End Of File.
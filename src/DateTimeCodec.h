@@ -0,0 +1,54 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeCodec.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Timestamp codec for DateTimeFunctions. Packs unix time series into blocks with delta of delta bit packing.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// Include
+#include "DateTimeFunctions.h"                       // Include The DateTimeFunctions Library
+
+// Settings
+#define DATETIMECODEC_HEADER 10                      // Block Header Bytes - First Timestamp (8) & Count (2)
+
+
+class DateTimeCodec {
+  public:                                            // Public
+    // Set
+    DateTimeCodec();                                                                                                    // Set The Class Object Name
+    // Encode
+    void begin(uint8_t* _BLOCK, const uint16_t _SIZE);                                                                  // Start A New Block - Clears The Block
+    bool add(const uint64_t _UNIXTIME);                                                                                 // Add A Timestamp To The Block - false = Block Full
+    // Decode
+    bool open(const uint8_t* _BLOCK, const uint16_t _SIZE);                                                             // Open A Block For Reading
+    bool next(uint64_t& _unixTime);                                                                                     // Get The Next Timestamp
+    bool next(uint8_t& _day, uint8_t& _month, uint16_t& _year, uint8_t& _hour, uint8_t& _min, uint8_t& _sec);           // Get The Next Timestamp - As Date Time Fields
+    static uint16_t decodeBlock(const uint8_t* _BLOCK, const uint16_t _SIZE, uint64_t* _out, const uint16_t _MAX);      // Decode A Whole Block
+    // Get
+    uint16_t getCount();                                                                                                // Get The Timestamps In The Block
+    uint16_t getBytes();                                                                                                // Get The Bytes Used In The Block
+    static bool getBlockInfo(const uint8_t* _BLOCK, uint64_t& _first, uint16_t& _count);                                // Get The Block Header
+    static uint32_t findBlock(const uint8_t* _BLOCKS, const uint32_t _BLOCKCOUNT, const uint16_t _SIZE, const uint64_t _UNIXTIME); // Find The Block That Holds A Timestamp
+
+  private:                                           // Private
+    uint8_t* _block;                                 // Block Being Written
+    const uint8_t* _read;                            // Block Being Read
+    uint16_t _size;                                  // Block Size - Bytes
+    uint16_t _count;                                 // Timestamps Written Or Left To Read
+    uint32_t _bit;                                   // Bit Position
+    uint64_t _last;                                  // Last Timestamp
+    int64_t _delta;                                  // Last Delta
+    bool _first;                                     // First Timestamp Not Read Yet
+    DateTimeFunctions _dTF;                          // Date Functions
+    // Write Bits - MSB First
+    void WRB(const uint32_t _VALUE, const uint8_t _BITS);
+    // Read Bits - MSB First
+    uint32_t RDB(const uint8_t _BITS);
+    // Read & Write The Little Endian Header Fields
+    static uint64_t RLE(const uint8_t* _BYTES, const uint8_t _LEN);
+    static void WLE(uint8_t* _bytes, const uint64_t _VALUE, const uint8_t _LEN);
+};
+
+// End Of File.
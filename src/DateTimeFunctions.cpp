@@ -10,6 +10,10 @@
 //
 
 #include "DateTimeFunctions.h"                    // Include The DateTimeFunctions Header
+#if DATETIMEFUNCTIONS_ISO_SIMD                     // SSE ISO 8601 Parser
+  #include <tmmintrin.h>                          // SSSE3 Intrinsics
+  #include <string.h>                             // strnlen()
+#endif
 
 #if DATETIMEFUNCTIONS_MEMORY_USE == 0             // Use Flash
 // Days In Month
@@ -21,6 +25,20 @@ const char DateTimeFunctions::MONTHNAME_L[12][10] PROGMEM = {"January", "Februar
 // Day Of Week Names
 const char DateTimeFunctions::DAYNAME_S[7][4] PROGMEM = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
 const char DateTimeFunctions::DAYNAME_L[7][10] PROGMEM = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+// Roman Numerals
+const char DateTimeFunctions::ROMAN_S[8] PROGMEM = "IVXLCDM";                                           // Roman Symbols
+const uint8_t DateTimeFunctions::ROMAN_P[10] PROGMEM = {0x00, 0x01, 0x05, 0x15, 0x09, 0x02, 0x06, 0x16, 0x56, 0x0D}; // Roman Digit Patterns
+#if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST                 // Fast Profile Tables
+const char DateTimeFunctions::DIGITS2[201] PROGMEM = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899"; // Two Digit Strings
+const uint16_t DateTimeFunctions::DOY_C[12] PROGMEM = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334}; // Days Before Each Month
+const char DateTimeFunctions::ROMAN_F[30][4] PROGMEM = {
+  "", "C", "CC", "CCC", "CD", "D", "DC", "DCC", {'D', 'C', 'C', 'C'}, "CM",  // Hundreds
+  "", "X", "XX", "XXX", "XL", "L", "LX", "LXX", {'L', 'X', 'X', 'X'}, "XC",  // Tens
+  "", "I", "II", "III", "IV", "V", "VI", "VII", {'V', 'I', 'I', 'I'}, "IX"   // Units
+};
+#endif
+// Leap Seconds - Unix Time Of 01/07/1972 ... 01/01/2017 (TAI - UTC = 11 ... 37)
+const uint32_t DateTimeFunctions::LEAP_UT[27] PROGMEM = {78796800UL, 94694400UL, 126230400UL, 157766400UL, 189302400UL, 220924800UL, 252460800UL, 283996800UL, 315532800UL, 362793600UL, 394329600UL, 425865600UL, 489024000UL, 567993600UL, 631152000UL, 662688000UL, 709948800UL, 741484800UL, 773020800UL, 820454400UL, 867715200UL, 915148800UL, 1136073600UL, 1230768000UL, 1341100800UL, 1435708800UL, 1483228800UL};
 #else                                             // Use SRAM
 // Days In Month
 const uint8_t DateTimeFunctions::DIM_N[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}; // Days In Month - Not Leap Year
@@ -31,6 +49,20 @@ const char DateTimeFunctions::MONTHNAME_L[12][10] = {"January", "February", "Mar
 // Day Of Week Names
 const char DateTimeFunctions::DAYNAME_S[7][4] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
 const char DateTimeFunctions::DAYNAME_L[7][10] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+// Roman Numerals
+const char DateTimeFunctions::ROMAN_S[8] = "IVXLCDM";                                                   // Roman Symbols
+const uint8_t DateTimeFunctions::ROMAN_P[10] = {0x00, 0x01, 0x05, 0x15, 0x09, 0x02, 0x06, 0x16, 0x56, 0x0D}; // Roman Digit Patterns
+#if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST                 // Fast Profile Tables
+const char DateTimeFunctions::DIGITS2[201] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899"; // Two Digit Strings
+const uint16_t DateTimeFunctions::DOY_C[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334}; // Days Before Each Month
+const char DateTimeFunctions::ROMAN_F[30][4] = {
+  "", "C", "CC", "CCC", "CD", "D", "DC", "DCC", {'D', 'C', 'C', 'C'}, "CM",  // Hundreds
+  "", "X", "XX", "XXX", "XL", "L", "LX", "LXX", {'L', 'X', 'X', 'X'}, "XC",  // Tens
+  "", "I", "II", "III", "IV", "V", "VI", "VII", {'V', 'I', 'I', 'I'}, "IX"   // Units
+};
+#endif
+// Leap Seconds - Unix Time Of 01/07/1972 ... 01/01/2017 (TAI - UTC = 11 ... 37)
+const uint32_t DateTimeFunctions::LEAP_UT[27] = {78796800UL, 94694400UL, 126230400UL, 157766400UL, 189302400UL, 220924800UL, 252460800UL, 283996800UL, 315532800UL, 362793600UL, 394329600UL, 425865600UL, 489024000UL, 567993600UL, 631152000UL, 662688000UL, 709948800UL, 741484800UL, 773020800UL, 820454400UL, 867715200UL, 915148800UL, 1136073600UL, 1230768000UL, 1341100800UL, 1435708800UL, 1483228800UL};
 #endif
 
 // Static String Buffer
@@ -54,6 +86,33 @@ bool DateTimeFunctions::_CLOCKFORMAT_   = true;        // Clock Format: ture = 2
 bool DateTimeFunctions::_USEDATEZERO_   = true;        // Date Zero: true = 01/01/YYYY & false = 1/1/YYYY
 bool DateTimeFunctions::_USEHOURZERO_   = true;        // Hour Zero: true = 01:MM:SS & false = 1:MM:SS
 
+// Leap Seconds - Loaded Table & Cached Interval
+const uint32_t* DateTimeFunctions::_LEAPRAM_ = NULL;   // Loaded Table: NULL = Built In Table
+uint8_t DateTimeFunctions::_LEAPCOUNT_ = sizeof(LEAP_UT) / sizeof(LEAP_UT[0]); // Leap Seconds In The Table
+bool DateTimeFunctions::_LEAPSMEAR_    = false;        // Leap Smear: true = 24.hour Linear Smear & false = Step (23:59:60)
+int64_t DateTimeFunctions::_LEAPFROM_  = 0;            // Cache: Unix Time Where The Offset Starts
+uint64_t DateTimeFunctions::_LEAPSPAN_ = 0;            // Cache: Seconds Until The Next Leap Second (0 = Empty)
+uint8_t DateTimeFunctions::_LEAPINDEX_ = 0;            // Cache: Leap Seconds Before The Interval
+
+// Instrumentation
+#if DATETIMEFUNCTIONS_STATS                            // Count Calls & Cycles
+#if !defined(ARDUINO) && (defined(__x86_64__) || defined(__i386__))
+  #include <x86intrin.h>                               // __rdtsc()
+#elif !defined(ARDUINO)
+  #include <time.h>                                    // clock_gettime()
+#endif
+#define DATETIMEFUNCTIONS_STAT_NAME(_NAME) #_NAME "\0"
+const char DateTimeFunctions::STATNAMES[] PROGMEM = DATETIMEFUNCTIONS_STATS_LIST(DATETIMEFUNCTIONS_STAT_NAME); // Counted Function Names
+#define DATETIMEFUNCTIONS_STAT_NAMEMAX 23              // Longest Name - lastWeekdayOfMonthBatch
+#define DATETIMEFUNCTIONS_STAT_FITS(_NAME) static_assert(sizeof(#_NAME) - 1 <= DATETIMEFUNCTIONS_STAT_NAMEMAX, "Stats line buffer too small for " #_NAME);
+DATETIMEFUNCTIONS_STATS_LIST(DATETIMEFUNCTIONS_STAT_FITS)     // Every Name Fits The Stats Line
+#define DATETIMEFUNCTIONS_STAT_LINE (DATETIMEFUNCTIONS_STAT_NAMEMAX + 1 + 10 + 1 + 20 + 1 + 20 + 1) // Name Calls Cycles Cycles/Call & Null = 77
+DateTimeFunctionsStats DateTimeFunctions::__stats;     // Calls & Cycles
+#define STAT(_NAME) SS __stat(DATETIMEFUNCTIONS_STAT_##_NAME) // Count This Function
+#else                                                  // No Code
+#define STAT(_NAME)
+#endif
+
 
 //---------------------- Set ----------------------//
 
@@ -62,6 +121,7 @@ DateTimeFunctions::DateTimeFunctions() {}
 
 // Set The Date Format - setDFormat(1-4) 1-4
 void DateTimeFunctions::setDFormat(const uint8_t _SETDATEFORMAT) {
+  STAT(setDFormat);
   // Set The Date Format
   // 1 = DD/MM/YYYY & 2 = MM/DD/YYYY & 3 = YYYY/MM/DD & 4 = YYYY/DD/MM
   if (_SETDATEFORMAT >= 1 && _SETDATEFORMAT <= 4)
@@ -72,18 +132,21 @@ void DateTimeFunctions::setDFormat(const uint8_t _SETDATEFORMAT) {
 
 // Set The Clock Format - setCFormat(true/false) - true = 24.Hours & false = 12.Hours
 void DateTimeFunctions::setCFormat(const bool _SETBOOL) {
+  STAT(setCFormat);
   // Set The Clock Format
   _CLOCKFORMAT_ = _SETBOOL; // ture = 24.Hours & false = 12.Hours
 }
 
 // Set The Date Zero - setDZero(true/false) - true = 01/01/YYYY & false = 1/1/YYYY
 void DateTimeFunctions::setDZero(const bool _SETBOOL) {
+  STAT(setDZero);
   // Set The Date Zero
   _USEDATEZERO_ = _SETBOOL;              // true = Use Zero's & false = Dont Use Zero's
 }
 
 // Set The Hour Zero - setHZero(true/false) - true = 01:MM:SS & false = 1:MM:SS
 void DateTimeFunctions::setHZero(const bool _SETBOOL) {
+  STAT(setHZero);
   // Set The Hour Zero
   _USEHOURZERO_ = _SETBOOL;              // true = Use Zero's & false = Dont Use Zero's
 }
@@ -93,6 +156,7 @@ void DateTimeFunctions::setHZero(const bool _SETBOOL) {
 
 // Check For Leap Year - isLeap(year) = Returns: true If Leap Year "0-1"
 bool DateTimeFunctions::isLeap(const uint16_t _YEAR) {
+  STAT(isLeap);
   // Check For Leap Year
   if (_YEAR % 400U == 0U || (_YEAR % 4U == 0U && _YEAR % 100U != 0U)) return true; // Leap Year     = 1
   else return false;                                                               // Not Leap Year = 0
@@ -100,62 +164,120 @@ bool DateTimeFunctions::isLeap(const uint16_t _YEAR) {
 
 // Check For AM / PM - isPM(hour) = Returns: true If PM "0-1"
 bool DateTimeFunctions::isPM(const uint8_t _HOUR) {
+  STAT(isPM);
   // Check For AM / PM
   // _HOUR needs to be in 24.hour format.
   if (_HOUR >= 12) return true;
   else return false;
 }
 
+// Check For Valid Date - isValidDate(day, month, year) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::isValidDate(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(isValidDate);
+  // Check For Valid Date - Month 1-12 & Day 1 To Days In Month (29/02 Only In Leap Years)
+  return VDT(_DAY, _MONTH, _YEAR);                            // Use VDT()
+}
+
+// Check For Valid Time - isValidTime(hour, min, sec) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::isValidTime(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC) {
+  STAT(isValidTime);
+  // Check For Valid Time - 00:00:00 ... 23:59:59, And 23:59:60 For A Leap Second
+  return VTM(_HOUR, _MIN, _SEC);                              // Use VTM()
+}
+
+// Check For Valid Date Time - isValidDateTime(day, month, year, hour, min, sec) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::isValidDateTime(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC) {
+  STAT(isValidDateTime);
+  return VDT(_DAY, _MONTH, _YEAR) & VTM(_HOUR, _MIN, _SEC);   // Both Valid
+}
+
+// Check For Valid Date Time - isValidDateTime(fields, count, mask) = Returns: Valid Records "0-65535"
+uint16_t DateTimeFunctions::isValidDateTime(const DateTimeFields* _FIELDS, const uint16_t _COUNT, uint32_t* _mask) {
+  STAT(isValidDateTimeBatch);
+  // Batch - Bit (i & 31) Of _mask[i / 32] Is Set If Record i Is Valid. _mask needs (_COUNT + 31) / 32 words.
+  uint16_t _valid = 0U;                                       // Valid Records
+  uint32_t _word = 0UL;                                       // Mask Word
+  for (uint16_t _i = 0U; _i < _COUNT; _i++) {
+    const DateTimeFields& _F = _FIELDS[_i];                   // The Record
+    const uint8_t _OK = VDT(_F.day, _F.month, _F.year) & VTM(_F.hour, _F.minute, _F.second); // Valid
+    _valid += _OK;                                            // Count The Valid
+    _word |= (uint32_t)_OK << (_i & 31U);                     // Set The Bit
+    if ((_i & 31U) == 31U || _i + 1U == _COUNT) {             // Word Done
+      _mask[_i >> 5] = _word;                                 // Set The Mask Word
+      _word = 0UL;                                            // Next Word
+    }
+  }
+  return _valid;                                              // Return The Valid Records
+}
+
+// Valid Date - Private - Returns: true If Valid "0-1"
+bool DateTimeFunctions::VDT(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  // Days In Month - 28 + 2.bits Per Month From 0x3BBEECC: Jan = 3, Feb = 0, Mar = 3, Apr = 2 ...
+  // Leap Year - Divisible By 4, And Not By 25 (= 100) Or By 16 (= 400). 23593 * _YEAR <= 2621 is _YEAR % 25 == 0.
+  const uint8_t _LEAP = ((_YEAR & 3U) == 0U) & (((uint16_t)(_YEAR * 23593U) > 2621U) | ((_YEAR & 15U) == 0U));
+  const uint8_t _DIM = 28U + ((0x3BBEECCUL >> ((_MONTH & 15U) * 2U)) & 3U) + (_LEAP & (_MONTH == 2U)); // Days In Month
+  return ((uint8_t)(_MONTH - 1U) < 12U) & ((uint8_t)(_DAY - 1U) < _DIM);            // Month 1-12 & Day 1-DIM
+}
+
+// Valid Time - Private - Returns: true If Valid "0-1"
+bool DateTimeFunctions::VTM(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC) {
+  return (_HOUR < 24U) & (_MIN < 60U) & ((_SEC < 60U) | ((_SEC == 60U) & (_HOUR == 23U) & (_MIN == 59U))); // 23:59:60 = Leap Second
+}
+
 //---------------------- Get ----------------------//
 
 // Get Day Of Year - getDOY(day, month, year) = Returns: 1-366
 uint16_t DateTimeFunctions::getDOY(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(getDOY);
   // Day Of Year
-  uint16_t _doy = 0U;                                                   // Final DOY
-  uint8_t _i = 0;                                                       // for() Counter
-  if (_YEAR % 400U == 0U || (_YEAR % 4U == 0U && _YEAR % 100U != 0U)) { // Leap Year
-    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
-      for (_i = 0; _i < _MONTH - 1; _i++) _doy += PM(DIM_L + _i);       // Add The Months - Use Flash
-    #else                                                               // Use SRAM
-      for (_i = 0; _i < _MONTH - 1; _i++) _doy += DIM_L[_i];            // Add The Months - Use SRAM
-    #endif
-    _doy += _DAY;                                                       // Add The Days
-  }
-  else {                                                                // Not Leap Year
-    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
-      for (_i = 0; _i < _MONTH - 1; _i++) _doy += PM(DIM_N + _i);       // Add The Months - Use Flash
-    #else                                                               // Use SRAM
-      for (_i = 0; _i < _MONTH - 1; _i++) _doy += DIM_N[_i];            // Add The Months - Use SRAM
+  const uint8_t _LEAP = (_YEAR % 400U == 0U || (_YEAR % 4U == 0U && _YEAR % 100U != 0U)) ? 1 : 0; // Leap Year = 1
+  #if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST          // Fast - Table
+    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                 // Use Flash
+      const uint16_t _BEFORE = pgm_read_word(DOY_C + _MONTH - 1);         // Days Before The Month - Use Flash
+    #else                                                                 // Use SRAM
+      const uint16_t _BEFORE = DOY_C[_MONTH - 1];                         // Days Before The Month - Use SRAM
     #endif
-    _doy += _DAY;                                                       // Add The Days
-  }
-  // Return The Day Of Year
-  return _doy;                                                          // Return The Day Of Year
+    return _BEFORE + _DAY + ((_MONTH > 2) ? _LEAP : 0);                   // Return The Day Of Year
+  #else                                                                   // Small - No Table & No Loop
+    // 275 * month / 9 - 30 is the days before the month in a year where February has 30 days.
+    // From March, 2 days (1 in a leap year) are taken off for the short February.
+    return (275U * _MONTH) / 9U - ((_MONTH + 9U) / 12U) * (2U - _LEAP) + _DAY - 30U; // Return The Day Of Year
+  #endif
 }
 
 // Get Day Of Week - getDOW(day, month, year) = Returns: 0-6 "Sun-Sat"
 uint8_t DateTimeFunctions::getDOW(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(getDOW);
   // Day Of Week
   // https://en.wikipedia.org/wiki/Determination_of_the_day_of_the_week
-  // Sakamoto's method.
   // Sunday = 0 | Monday = 1 | Tuesday = 2 | Wednesday = 3 | Thursday = 4 | Friday = 5 | Saturday = 6
-  #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
-    const static uint8_t _DOWMONTHCAL[12] PROGMEM = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
-  #else                                                               // Use SRAM
-    const static uint8_t _DOWMONTHCAL[12] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
-  #endif
+  #if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST        // Fast - Sakamoto's Method
+    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
+      const static uint8_t _DOWMONTHCAL[12] PROGMEM = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+    #else                                                               // Use SRAM
+      const static uint8_t _DOWMONTHCAL[12] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+    #endif
   
-  uint16_t _year = _YEAR;
-  if (_MONTH < 3) _year -= 1U;
-  #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
-    return (_year + _year / 4 - _year / 100 + _year / 400 + PM(_DOWMONTHCAL + (_MONTH - 1)) + _DAY) % 7;
-  #else                                                               // Use SRAM
-    return (_year + _year / 4 - _year / 100 + _year / 400 + _DOWMONTHCAL[_MONTH - 1] + _DAY) % 7;
+    uint16_t _year = _YEAR;
+    if (_MONTH < 3) _year -= 1U;
+    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
+      return (_year + _year / 4 - _year / 100 + _year / 400 + PM(_DOWMONTHCAL + (_MONTH - 1)) + _DAY) % 7;
+    #else                                                               // Use SRAM
+      return (_year + _year / 4 - _year / 100 + _year / 400 + _DOWMONTHCAL[_MONTH - 1] + _DAY) % 7;
+    #endif
+  #else                                                                 // Small - Zeller's Congruence, No Table
+    // January & February are month 13 & 14 of the year before.
+    // (13 * (month + 1)) / 5 makes the month offsets. Zeller gives Saturday = 0, + 6 moves it to Sunday = 0.
+    uint16_t _year = _YEAR;                                             // Year
+    uint8_t _month = _MONTH;                                            // Month
+    if (_month < 3) { _month += 12; _year -= 1U; }                      // Jan & Feb Count As Last Year
+    return (_DAY + (13U * (_month + 1U)) / 5U + _year + _year / 4U - _year / 100U + _year / 400U + 6U) % 7U;
   #endif
 }
 
 // Get Day Of Week Name Short - getDOWNS(0-6) = Returns: Sun-Sat
 char* DateTimeFunctions::getDOWNS(const uint8_t _DOW) {
+  STAT(getDOWNS);
   // Day Of Week Name Short
   //const static char DAYNAME_S[7][4] PROGMEM = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
   char* _buffer = __dateTimeStaticBuffer;                                   // String Buffer
@@ -170,6 +292,7 @@ char* DateTimeFunctions::getDOWNS(const uint8_t _DOW) {
 
 // Get Day Of Week Name Long - getDOWNL(0-6) = Returns: Sunday-Saturday
 char* DateTimeFunctions::getDOWNL(const uint8_t _DOW) {
+  STAT(getDOWNL);
   // Day Of Week Name Long - 10924 / 285
   //const static char DAYNAME_L[7][10] PROGMEM = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
   char* _buffer = __dateTimeStaticBuffer;                                   // String Buffer
@@ -184,6 +307,7 @@ char* DateTimeFunctions::getDOWNL(const uint8_t _DOW) {
 
 // Get Week Of Year - getWOY(day, month, year) = Returns: 1-53 (ISO 8601)
 uint8_t DateTimeFunctions::getWOY(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(getWOY);
   // Week Of Year
   // https://en.wikipedia.org/wiki/ISO_week_date
   uint8_t _woy;                                                 // Week Of Year - (WOY)
@@ -222,6 +346,7 @@ uint8_t DateTimeFunctions::getWOY(const uint8_t _DAY, const uint8_t _MONTH, cons
 
 // Get Weeks In Year - getWIY(year) = Returns: 52-53
 uint8_t DateTimeFunctions::getWIY(const uint16_t _YEAR) {
+  STAT(getWIY);
   // Weeks In Year
   // https://en.wikipedia.org/wiki/ISO_week_date
   // 53 week years occur on all years that have Thursday as the 1st of January,
@@ -234,6 +359,7 @@ uint8_t DateTimeFunctions::getWIY(const uint16_t _YEAR) {
 
 // Get Days In Year - getDIY(year) = Returns: 365-366
 uint16_t DateTimeFunctions::getDIY(const uint16_t _YEAR) {
+  STAT(getDIY);
   // Days In Year
   // https://en.wikipedia.org/wiki/Common_year
   // https://en.wikipedia.org/wiki/Leap_year
@@ -243,6 +369,7 @@ uint16_t DateTimeFunctions::getDIY(const uint16_t _YEAR) {
 
 // Get Days Left In Year - getDLIY(day, month, year) = Returns: 0-365
 uint16_t DateTimeFunctions::getDLIY(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(getDLIY);
   // Days Left In Year
   uint16_t _diy = 0U;                                                   // Days In Year
   uint16_t _doy = 0U;                                                   // Day Of Year
@@ -270,6 +397,7 @@ uint16_t DateTimeFunctions::getDLIY(const uint8_t _DAY, const uint8_t _MONTH, co
 
 // Get Days In Month - getDIM(month, year) = Returns: 28-31
 uint8_t DateTimeFunctions::getDIM(const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(getDIM);
   // Days In Month
   #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                 // Use Flash
     if (_YEAR % 400U == 0U || (_YEAR % 4U == 0U && _YEAR % 100U != 0U)) // Leap Year
@@ -284,8 +412,145 @@ uint8_t DateTimeFunctions::getDIM(const uint8_t _MONTH, const uint16_t _YEAR) {
   #endif
 }
 
+// Get Easter Sunday - getEaster(year, day, month) = Sets: day & month "22/03 ... 25/04"
+void DateTimeFunctions::getEaster(const uint16_t _YEAR, uint8_t& _day, uint8_t& _month) {
+  STAT(getEaster);
+  // Easter Sunday - Gregorian Calendar
+  // https://en.wikipedia.org/wiki/Date_of_Easter#Anonymous_Gregorian_algorithm
+  // Meeus/Jones/Butcher computus. No tables, no loops.
+  const uint8_t _A = _YEAR % 19U;                                       // Place In The 19.year Moon Cycle
+  const uint16_t _B = _YEAR / 100U;                                     // Century
+  const uint8_t _C = _YEAR % 100U;                                      // Year Of The Century
+  const uint8_t _D = (_B / 4U) % 30U;                                   // Century Leap Days (mod 30, Fits 8.bits)
+  const uint8_t _E = _B % 4U;                                           // Century Leap Days Left
+  const uint8_t _G = ((8U * _B + 13U) / 25U) % 30U;                     // Moon Correction
+  const uint8_t _H = (19U * _A + _B % 30U + 30U - _D + 30U - _G + 15U) % 30U; // Days From 21/03 To The Full Moon
+  const uint8_t _I = _C / 4U;                                           // Year Leap Days
+  const uint8_t _K = _C % 4U;                                           // Year Leap Days Left
+  const uint8_t _L = (32U + 2U * _E + 2U * _I + 7U * 6U - _H - _K) % 7U; // Days To Sunday
+  const uint8_t _M = (_A + 11U * _H + 22U * _L) / 451U;                 // Late Full Moon Correction
+  const uint8_t _DAYS = _H + _L + 114U - 7U * _M;                       // Day & Month In One
+  _month = _DAYS / 31U;                                                 // Set The Month (3 Or 4)
+  _day = (_DAYS % 31U) + 1U;                                            // Set The Day
+}
+
+// Get Nth Weekday Of Month - nthWeekdayOfMonth(2, 0, 3, 2024) = 2nd Sunday Of March = Returns: Day 1-31, 0 = None
+uint8_t DateTimeFunctions::nthWeekdayOfMonth(const int8_t _N, const uint8_t _DOW, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(nthWeekdayOfMonth);
+  // _N: 1-5 = From The Start & -1 ... -5 = From The End. _DOW: 0-6 "Sun-Sat"
+  if (_N == 0 || _N > 5 || _N < -5 || _DOW > 6U || _MONTH < 1U || _MONTH > 12U) return 0; // Not Valid
+  return NWD(_N, _DOW, getDOW(1, _MONTH, _YEAR), getDIM(_MONTH, _YEAR)); // One getDOW() & getDIM()
+}
+
+// Get Nth Weekday Of Month For Years - nthWeekdayOfMonth(n, dow, month, year, out, count) = Returns: Years That Have One
+uint16_t DateTimeFunctions::nthWeekdayOfMonth(const int8_t _N, const uint8_t _DOW, const uint8_t _MONTH, const uint16_t _YEAR, uint8_t* _OUT, const uint16_t _COUNT) {
+  STAT(nthWeekdayOfMonthBatch);
+  // _OUT[i] = The Day In Year _YEAR + i, 0 = None. Only one getDOW(): from one year to the next
+  // day 1 of the month moves on 1 weekday, or 2 when a 29/02 is in between.
+  const bool _VALID = !(_N == 0 || _N > 5 || _N < -5 || _DOW > 6U || _MONTH < 1U || _MONTH > 12U); // Valid
+  uint8_t _first = _VALID ? getDOW(1, _MONTH, _YEAR) : 0U;  // Weekday Of Day 1
+  const uint8_t _DIM = _VALID ? getDIM(_MONTH, 2001U) : 0U; // Days In Month - Not Leap Year
+  uint16_t _found = 0U;                                     // Years That Have One
+  for (uint16_t _i = 0U; _i < _COUNT; _i++) {
+    const uint16_t _Y = _YEAR + _i;                         // Year
+    const bool _LEAP = isLeap(_Y);                          // Leap Year
+    _OUT[_i] = _VALID ? NWD(_N, _DOW, _first, _DIM + (_MONTH == 2U && _LEAP)) : 0U; // The Day
+    _found += (_OUT[_i] != 0U);                             // Count It
+    _first += 1U + ((_MONTH <= 2U) ? _LEAP : isLeap(_Y + 1U)); // Day 1 Next Year - 29/02 Before It This Year Or Next Year
+    if (_first >= 7U) _first -= 7U;                         // Wrap The Weekday
+  }
+  return _found;                                            // Return The Years That Have One
+}
+
+// Get Last Weekday Of Month - lastWeekdayOfMonth(5, 11, 2024) = Last Friday Of November = Returns: Day 22-31, 0 = Not Valid
+uint8_t DateTimeFunctions::lastWeekdayOfMonth(const uint8_t _DOW, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(lastWeekdayOfMonth);
+  if (_DOW > 6U || _MONTH < 1U || _MONTH > 12U) return 0;   // Not Valid
+  return NWD(-1, _DOW, getDOW(1, _MONTH, _YEAR), getDIM(_MONTH, _YEAR)); // One getDOW() & getDIM()
+}
+
+// Get Last Weekday Of Month For Years - lastWeekdayOfMonth(dow, month, year, out, count) = Returns: Years Set
+uint16_t DateTimeFunctions::lastWeekdayOfMonth(const uint8_t _DOW, const uint8_t _MONTH, const uint16_t _YEAR, uint8_t* _OUT, const uint16_t _COUNT) {
+  STAT(lastWeekdayOfMonthBatch);
+  return nthWeekdayOfMonth(-1, _DOW, _MONTH, _YEAR, _OUT, _COUNT); // Use nthWeekdayOfMonth() - Last = -1
+}
+
+// Get The Weekday On Or After A Date - weekdayOnOrAfter(0, 25, 3, 2024, day, month, year) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::weekdayOnOrAfter(const uint8_t _DOW, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, uint8_t& _day, uint8_t& _month, uint16_t& _year) {
+  STAT(weekdayOnOrAfter);
+  // Can Go Into The Next Month Or Year. 65535 Stops At 31/12.
+  if (_DOW > 6U || !VDT(_DAY, _MONTH, _YEAR)) return false;          // Not Valid
+  const uint8_t _DIM = getDIM(_MONTH, _YEAR);                        // Days In Month
+  uint8_t _d = _DAY + (_DOW + 7U - getDOW(_DAY, _MONTH, _YEAR)) % 7U; // Days To The Weekday
+  _month = _MONTH; _year = _YEAR;                                    // Same Month
+  if (_d > _DIM) {                                                   // Next Month
+    if (_MONTH == 12U && _YEAR == 65535U) return false;              // Past The Last Year
+    _d -= _DIM;                                                      // Day In The Next Month
+    if (++_month > 12U) { _month = 1U; _year++; }                    // Next Year
+  }
+  _day = _d;                                                         // Set The Day
+  return true;
+}
+
+// Get The Weekday On Or Before A Date - weekdayOnOrBefore(0, 31, 3, 2024, day, month, year) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::weekdayOnOrBefore(const uint8_t _DOW, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, uint8_t& _day, uint8_t& _month, uint16_t& _year) {
+  STAT(weekdayOnOrBefore);
+  // Can Go Into The Month Or Year Before. Year 0 Stops At 01/01.
+  if (_DOW > 6U || !VDT(_DAY, _MONTH, _YEAR)) return false;          // Not Valid
+  const uint8_t _BACK = (getDOW(_DAY, _MONTH, _YEAR) + 7U - _DOW) % 7U; // Days Back To The Weekday
+  _month = _MONTH; _year = _YEAR;                                    // Same Month
+  if (_BACK >= _DAY) {                                               // Month Before
+    if (_MONTH == 1U && _YEAR == 0U) return false;                   // Before The First Year
+    if (--_month < 1U) { _month = 12U; _year--; }                    // Year Before
+    _day = getDIM(_month, _year) + _DAY - _BACK;                     // Day In The Month Before
+  }
+  else _day = _DAY - _BACK;                                          // Same Month
+  return true;
+}
+
+// Get Month Calendar Grid - getMonthGrid(month, year, grid, true/false, today) = Sets: grid
+void DateTimeFunctions::getMonthGrid(const uint8_t _MONTH, const uint16_t _YEAR, DateTimeMonthGrid& _grid, const bool _MONDAYFIRST, const uint8_t _TODAY) {
+  STAT(getMonthGrid);
+  // One Pass Over The 42.Cells - Only One getDOW() & The Days In This And The Month Before.
+  // _TODAY: Day Of Month To Mark, 0 = None. The ISO week of a row is the week of its Thursday:
+  // (Day Of Year Of The Thursday + 6) / 7, in the year the Thursday is in.
+  const uint16_t _PREVYEAR = (_MONTH == 1) ? _YEAR - 1U : _YEAR;        // Year Of The Month Before
+  const uint8_t _DIMPREV = getDIM((_MONTH == 1) ? 12 : _MONTH - 1, _PREVYEAR); // Days In The Month Before
+  const uint8_t _DIM = getDIM(_MONTH, _YEAR);                           // Days In The Month
+  const uint16_t _DIYPREV = isLeap(_YEAR - 1U) ? 366U : 365U;           // Days In The Year Before
+  const uint16_t _DIY = isLeap(_YEAR) ? 366U : 365U;                    // Days In The Year
+  const uint16_t _DOY1 = getDOY(1, _MONTH, _YEAR);                      // Day Of Year Of Day 1
+  const uint8_t _FIRST = (getDOW(1, _MONTH, _YEAR) + (_MONDAYFIRST ? 6U : 0U)) % 7U; // Cell Of Day 1
+  const uint8_t _THU = _MONDAYFIRST ? 3 : 4;                            // Thursday Column
+  _grid.first = _FIRST;                                                 // Set The Cell Of Day 1
+  _grid.rows = (_FIRST + _DIM + 6U) / 7U;                               // Set The Rows Used
+  _grid.today = 255;                                                    // No Today
+  _grid.month = _MONTH;                                                 // Set The Month
+  _grid.year = _YEAR;                                                   // Set The Year
+  _grid.mondayFirst = _MONDAYFIRST;                                     // Set The First Column
+  for (uint8_t _row = 0, _cell = 0; _row < 6; _row++) {
+    uint8_t _in = 0;                                                    // In Month Bits
+    for (uint8_t _col = 0; _col < 7; _col++, _cell++) {
+      const int8_t _K = (int8_t)_cell - (int8_t)_FIRST;                 // Days From Day 1
+      if (_K < 0) _grid.day[_cell] = _DIMPREV + _K + 1;                 // The Month Before
+      else if (_K < _DIM) {                                             // The Month
+        _grid.day[_cell] = _K + 1;                                      // Set The Day
+        _in |= 1U << _col;                                              // In The Month
+        if (_K + 1 == _TODAY) _grid.today = _cell;                      // Today
+      }
+      else _grid.day[_cell] = _K - _DIM + 1;                            // The Month After
+    }
+    _grid.inMonth[_row] = _in;                                          // Set The In Month Bits
+    int16_t _doy = (int16_t)_DOY1 + (int16_t)(_row * 7U + _THU) - (int16_t)_FIRST; // Day Of Year Of The Thursday
+    if (_doy < 1) _doy += _DIYPREV;                                     // In The Year Before
+    else if (_doy > (int16_t)_DIY) _doy -= _DIY;                        // In The Year After
+    _grid.week[_row] = (_doy + 6) / 7;                                  // Set The ISO Week
+  }
+}
+
 // Get Month Name Short - getMNS(month) = Returns: Jan-Dec
 char* DateTimeFunctions::getMNS(const uint8_t _MONTH) {
+  STAT(getMNS);
   // Month Names Short
   //const static char MONTHNAME_S[12][4] PROGMEM = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
   char* _buffer = __dateTimeStaticBuffer;                                     // String Buffer
@@ -300,6 +565,7 @@ char* DateTimeFunctions::getMNS(const uint8_t _MONTH) {
 
 // Get Month Name Long - getMNL(month) = Returns: January-December
 char* DateTimeFunctions::getMNL(const uint8_t _MONTH) {
+  STAT(getMNL);
   // Month Names Long
   //const static char MONTHNAME_L[12][10] PROGMEM = {"January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
   char* _buffer = __dateTimeStaticBuffer;                                     // String Buffer
@@ -314,6 +580,7 @@ char* DateTimeFunctions::getMNL(const uint8_t _MONTH) {
 
 // Get Days Between Date - getDBD(day1, month1, year1, day2, month2, year2) = Returns: 0-65535
 uint16_t DateTimeFunctions::getDBD(const uint8_t _DAY1, const uint8_t _MONTH1, const uint16_t _YEAR1, const uint8_t _DAY2, const uint8_t _MONTH2, const uint16_t _YEAR2) {
+  STAT(getDBD);
   // Days Between Date
   
   // Wrong Format - Return
@@ -359,18 +626,21 @@ uint16_t DateTimeFunctions::getDBD(const uint8_t _DAY1, const uint8_t _MONTH1, c
 
 // Get Seconds From Midnight - getSFM(hour, minute, seconds) = Returns: 0-86399
 uint32_t DateTimeFunctions::getSFM(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC) {
+  STAT(getSFM);
   // Seconds From Midnight
   return (_HOUR * 3600UL) + (_MIN * 60UL) + _SEC;
 }
 
 // Get Minutes From Midnight - getMFM(hour, minute) = Returns: 0-1439
 uint16_t DateTimeFunctions::getMFM(const uint8_t _HOUR, const uint8_t _MIN) {
+  STAT(getMFM);
   // Minutes From Midnight
   return (_HOUR * 60U) + _MIN;
 }
 
 // Get AM / PM - getAMPM(hour) = Returns: AM or PM
 char* DateTimeFunctions::getAMPM(const uint8_t _HOUR) {
+  STAT(getAMPM);
   // Get AM / PM
   // _HOUR needs to be in 24.hour format.
   // Max String = XX = 2.characters.
@@ -382,11 +652,25 @@ char* DateTimeFunctions::getAMPM(const uint8_t _HOUR) {
   return _buffer;                                    // Return The Time String
 }
 
+// Get The Width Of A Format - getFormatWidth(DATETIMEFUNCTIONS_FORMAT_ISO) = Returns: Characters, 0 = Not Fixed
+uint8_t DateTimeFunctions::getFormatWidth(const uint8_t _FORMAT) {
+  STAT(getFormatWidth);
+  // Fixed when the date & hour zeros are on, for years 1000-9999. Timestamp i of the batch
+  // conUT2DT() is then at i * (width + 1), with no offsets needed. A year past 9999 is one wider.
+  if (_FORMAT == DATETIMEFUNCTIONS_FORMAT_ISO) return 20;     // YYYY-MM-DDTHH:MM:SSZ
+  if (_FORMAT > DATETIMEFUNCTIONS_FORMAT_DATE_NAME || !_USEDATEZERO_) return 0; // Not A Format Or The Day Varies
+  const uint8_t _DATE = (_FORMAT & 1U) ? 11U : 10U;          // DD/Jan/YYYY Or DD/MM/YYYY
+  if (_FORMAT >= DATETIMEFUNCTIONS_FORMAT_DATE) return _DATE; // No Clock
+  if (!_USEHOURZERO_) return 0;                               // The Hour Varies
+  return _DATE + (_CLOCKFORMAT_ ? 11U : 14U);                 // " - HH:MM:SS" & " AM"
+}
+
 
 //-------------------- Convert --------------------//
 
 // Convert 24.Hour To 12.Hour - con24To12(hour) = Returns: 1-12
 uint8_t DateTimeFunctions::con24To12(const uint8_t _HOUR) {
+  STAT(con24To12);
   // Convert 24.Hour To 12.Hour
   uint8_t _hour = _HOUR;                                  // Get The Hour
   if (_HOUR > 12) _hour -= 12;                            // Convert 24.h To 12.h (PM)
@@ -396,6 +680,7 @@ uint8_t DateTimeFunctions::con24To12(const uint8_t _HOUR) {
 
 // Convert 12.Hour To 24.Hour - con12To24(hour, AorP) = Returns: 0-23
 uint8_t DateTimeFunctions::con12To24(const uint8_t _HOUR, const char _AorP) {
+  STAT(con12To24);
   // Convert 12.Hour To 24.Hour
   uint8_t _hour = _HOUR;                                  // Get The Hour
   if ((_AorP == 'P' || _AorP == 'p') && _HOUR != 12)      // Convert 12.h To 24.h (PM)
@@ -407,194 +692,70 @@ uint8_t DateTimeFunctions::con12To24(const uint8_t _HOUR, const char _AorP) {
 
 // Make The Date Time String - Private
 char* DateTimeFunctions::MTDTS(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const uint8_t _TYPE) {
+  // Make The Date Time String - Into The Static Buffer
+  return MTDTS(__dateTimeStaticBuffer, _DAY, _MONTH, _YEAR, _HOUR, _MIN, _SEC, _TYPE);
+}
+
+// Make The Date Time String - Private
+char* DateTimeFunctions::MTDTS(char* _buffer, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const uint8_t _TYPE) {
+  STAT(MTDTS);
+  MTS(_buffer, _DAY, _MONTH, _YEAR, _HOUR, _MIN, _SEC, _TYPE);  // Make The String
+  return _buffer;                                             // Return The Time String
+}
+
+// Make The Date Time String - Private - Returns: Length
+uint8_t DateTimeFunctions::MTS(char* _buffer, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const uint8_t _TYPE) {
   // Make The Date Time String
   // _TYPE: 0 = 01/01/0000 - HH:MM:SS  &  1 = 01/Jan/0000 - HH:MM:SS  &  2 = 01/01/0000  &  3 = 01/Jan/0000
   // Max String = 31/12/65535 - 23:59:59 = 22.characters.
   // Max String = 31/Dec/65535 - 23:59:59 = 23.characters.
   // Max String = 31/Dec/65535 - 12:59:59 AM = 26.characters.
-  char* _buffer = __dateTimeStaticBuffer;                     // String Buffer
+  // _buffer needs to be 27.bytes. Only reads the format settings, so it is safe to call from many threads.
   uint8_t _index = 0;                                         // String Index
+  const bool _NAME = (_TYPE == 1 || _TYPE == 3);              // Use Month Name
 
-  // Make The String
-  if (_DATEFORMAT_ == 1) {                                    // DD/MM/YYYY
-    // Day
-    if (_USEDATEZERO_ || _DAY >= 10)                          // Add The First Digit
-      _buffer[_index++] = (_DAY / 10) + '0';                  // Add The First Digit In Date
-    _buffer[_index++] = (_DAY % 10) + '0';                    // Add The Second Digit In Date
+  // Make The Date String
+  #if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST // Fast - One Straight Line Per Format
+  // Date Format: 1 = DD/MM/YYYY & 2 = MM/DD/YYYY & 3 = YYYY/MM/DD & 4 = YYYY/DD/MM
+  if (_DATEFORMAT_ == 2) {                                    // MM/DD/YYYY
+    _index += _NAME ? AMN(_buffer, _MONTH) : A2D(_buffer, _MONTH, _USEDATEZERO_); // Add The Month
     _buffer[_index++] = '/';                                  // Add The /
-
-    // Month
-    if (_TYPE == 0 || _TYPE == 2) {                           // Add Month Number
-      if (_USEDATEZERO_ || _MONTH >= 10)                      // Add The First Digit
-        _buffer[_index++] = (_MONTH / 10) + '0';              // Add The First Digit In Month
-      _buffer[_index++] = (_MONTH % 10) + '0';                // Add The Second Digit In Month
-      _buffer[_index++] = '/';                                // Add The /
-    }
-    else if (_TYPE == 1 || _TYPE == 3) {                      // Add The Month Names (Short)
-      #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                       // Use Flash
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][0]));   // First Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][1]));   // Second Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][2]));   // Third Characters
-      #else                                                                       // Use SRAM
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][0];                           // First Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][1];                           // Second Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][2];                           // Third Characters
-      #endif
-      _buffer[_index++] = '/';                                                    // Add The /
-    }
-
-    // Year
-    if ((_YEAR / 1000U) > 0)
-      _buffer[_index++] = (_YEAR / 1000U) + '0';              // Add The First Digit In Year
-    if (((_YEAR / 10U) / 10U) % 10U > 0 || (_YEAR / 1000U) > 0)
-      _buffer[_index++] = ((_YEAR / 10U) / 10U) % 10U + '0';  // Add The Second Digit In Year
-    if ((_YEAR / 10U) % 10U > 0 || ((_YEAR / 10U) / 10U) % 10U > 0)
-      _buffer[_index++] = (_YEAR / 10U) % 10U + '0';          // Add The Third Digit In Year
-    _buffer[_index++] = _YEAR % 10U + '0';                    // Add The Fourth Digit In Year
-  }
-  else if (_DATEFORMAT_ == 2) {                               // MM/DD/YYYY
-    // Month
-    if (_TYPE == 0 || _TYPE == 2) {                           // Add Month Number
-      if (_USEDATEZERO_ || _MONTH >= 10)                      // Add The First Digit
-        _buffer[_index++] = (_MONTH / 10) + '0';              // Add The First Digit In Month
-      _buffer[_index++] = (_MONTH % 10) + '0';                // Add The Second Digit In Month
-      _buffer[_index++] = '/';                                // Add The /
-    }
-    else if (_TYPE == 1 || _TYPE == 3) {                      // Add The Month Names (Short)
-      #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                       // Use Flash
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][0]));   // First Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][1]));   // Second Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][2]));   // Third Characters
-      #else                                                                       // Use SRAM
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][0];                           // First Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][1];                           // Second Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][2];                           // Third Characters
-      #endif
-      _buffer[_index++] = '/';                                                    // Add The /
-    }
-
-    // Day
-    if (_USEDATEZERO_ || _DAY >= 10)                          // Add The First Digit
-      _buffer[_index++] = (_DAY / 10) + '0';                  // Add The First Digit In Date
-    _buffer[_index++] = (_DAY % 10) + '0';                    // Add The Second Digit In Date
+    _index += A2D(_buffer + _index, _DAY, _USEDATEZERO_);     // Add The Day
     _buffer[_index++] = '/';                                  // Add The /
-
-    // Year
-    if ((_YEAR / 1000U) > 0)
-      _buffer[_index++] = (_YEAR / 1000U) + '0';              // Add The First Digit In Year
-    if (((_YEAR / 10U) / 10U) % 10U > 0 || (_YEAR / 1000U) > 0)
-      _buffer[_index++] = ((_YEAR / 10U) / 10U) % 10U + '0';  // Add The Second Digit In Year
-    if ((_YEAR / 10U) % 10U > 0 || ((_YEAR / 10U) / 10U) % 10U > 0)
-      _buffer[_index++] = (_YEAR / 10U) % 10U + '0';          // Add The Third Digit In Year
-    _buffer[_index++] = _YEAR % 10U + '0';                    // Add The Fourth Digit In Year
+    _index += AYR(_buffer + _index, _YEAR);                   // Add The Year
   }
   else if (_DATEFORMAT_ == 3) {                               // YYYY/MM/DD
-    // Year
-    if ((_YEAR / 1000U) > 0)
-      _buffer[_index++] = (_YEAR / 1000U) + '0';              // Add The First Digit In Year
-    if (((_YEAR / 10U) / 10U) % 10U > 0 || (_YEAR / 1000U) > 0)
-      _buffer[_index++] = ((_YEAR / 10U) / 10U) % 10U + '0';  // Add The Second Digit In Year
-    if ((_YEAR / 10U) % 10U > 0 || ((_YEAR / 10U) / 10U) % 10U > 0)
-      _buffer[_index++] = (_YEAR / 10U) % 10U + '0';          // Add The Third Digit In Year
-    _buffer[_index++] = _YEAR % 10U + '0';                    // Add The Fourth Digit In Year
+    _index += AYR(_buffer, _YEAR);                            // Add The Year
     _buffer[_index++] = '/';                                  // Add The /
-
-    // Month
-    if (_TYPE == 0 || _TYPE == 2) {                           // Add Month Number
-      if (_USEDATEZERO_ || _MONTH >= 10)                      // Add The First Digit
-        _buffer[_index++] = (_MONTH / 10) + '0';              // Add The First Digit In Month
-      _buffer[_index++] = (_MONTH % 10) + '0';                // Add The Second Digit In Month
-      _buffer[_index++] = '/';                                // Add The /
-    }
-    else if (_TYPE == 1 || _TYPE == 3) {                      // Add The Month Names (Short)
-      #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                       // Use Flash
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][0]));   // First Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][1]));   // Second Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][2]));   // Third Characters
-      #else                                                                       // Use SRAM
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][0];                           // First Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][1];                           // Second Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][2];                           // Third Characters
-      #endif
-      _buffer[_index++] = '/';                                                    // Add The /
-    }
-
-    // Day
-    if (_USEDATEZERO_ || _DAY >= 10)                          // Add The First Digit
-      _buffer[_index++] = (_DAY / 10) + '0';                  // Add The First Digit In Date
-    _buffer[_index++] = (_DAY % 10) + '0';                    // Add The Second Digit In Date
+    _index += _NAME ? AMN(_buffer + _index, _MONTH) : A2D(_buffer + _index, _MONTH, _USEDATEZERO_); // Add The Month
+    _buffer[_index++] = '/';                                  // Add The /
+    _index += A2D(_buffer + _index, _DAY, _USEDATEZERO_);     // Add The Day
   }
   else if (_DATEFORMAT_ == 4) {                               // YYYY/DD/MM
-    // Year
-    if ((_YEAR / 1000U) > 0)
-      _buffer[_index++] = (_YEAR / 1000U) + '0';              // Add The First Digit In Year
-    if (((_YEAR / 10U) / 10U) % 10U > 0 || (_YEAR / 1000U) > 0)
-      _buffer[_index++] = ((_YEAR / 10U) / 10U) % 10U + '0';  // Add The Second Digit In Year
-    if ((_YEAR / 10U) % 10U > 0 || ((_YEAR / 10U) / 10U) % 10U > 0)
-      _buffer[_index++] = (_YEAR / 10U) % 10U + '0';          // Add The Third Digit In Year
-    _buffer[_index++] = _YEAR % 10U + '0';                    // Add The Fourth Digit In Year
+    _index += AYR(_buffer, _YEAR);                            // Add The Year
     _buffer[_index++] = '/';                                  // Add The /
-
-    // Day
-    if (_USEDATEZERO_ || _DAY >= 10)                          // Add The First Digit
-      _buffer[_index++] = (_DAY / 10) + '0';                  // Add The First Digit In Date
-    _buffer[_index++] = (_DAY % 10) + '0';                    // Add The Second Digit In Date
+    _index += A2D(_buffer + _index, _DAY, _USEDATEZERO_);     // Add The Day
     _buffer[_index++] = '/';                                  // Add The /
-
-    // Month
-    if (_TYPE == 0 || _TYPE == 2) {                           // Add Month Number
-      if (_USEDATEZERO_ || _MONTH >= 10)                      // Add The First Digit
-        _buffer[_index++] = (_MONTH / 10) + '0';              // Add The First Digit In Month
-      _buffer[_index++] = (_MONTH % 10) + '0';                // Add The Second Digit In Month
-    }
-    else if (_TYPE == 1 || _TYPE == 3) {                      // Add The Month Names (Short)
-      #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                       // Use Flash
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][0]));   // First Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][1]));   // Second Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][2]));   // Third Characters
-      #else                                                                       // Use SRAM
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][0];                           // First Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][1];                           // Second Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][2];                           // Third Characters
-      #endif
-    }
+    _index += _NAME ? AMN(_buffer + _index, _MONTH) : A2D(_buffer + _index, _MONTH, _USEDATEZERO_); // Add The Month
   }
   else {                                                      // DD/MM/YYYY
-    // Day
-    if (_USEDATEZERO_ || _DAY >= 10)                          // Add The First Digit
-      _buffer[_index++] = (_DAY / 10) + '0';                  // Add The First Digit In Date
-    _buffer[_index++] = (_DAY % 10) + '0';                    // Add The Second Digit In Date
+    _index += A2D(_buffer, _DAY, _USEDATEZERO_);              // Add The Day
     _buffer[_index++] = '/';                                  // Add The /
-
-    // Month
-    if (_TYPE == 0 || _TYPE == 2) {                           // Add Month Number
-      if (_USEDATEZERO_ || _MONTH >= 10)                      // Add The First Digit
-        _buffer[_index++] = (_MONTH / 10) + '0';              // Add The First Digit In Month
-      _buffer[_index++] = (_MONTH % 10) + '0';                // Add The Second Digit In Month
-      _buffer[_index++] = '/';                                // Add The /
-    }
-    else if (_TYPE == 1 || _TYPE == 3) {                      // Add The Month Names (Short)
-      #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                       // Use Flash
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][0]));   // First Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][1]));   // Second Characters
-        _buffer[_index++] = (char)pgm_read_word(&(MONTHNAME_S[_MONTH - 1][2]));   // Third Characters
-      #else                                                                       // Use SRAM
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][0];                           // First Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][1];                           // Second Characters
-        _buffer[_index++] = MONTHNAME_S[_MONTH - 1][2];                           // Third Characters
-      #endif
-      _buffer[_index++] = '/';                                                    // Add The /
-    }
-
-    // Year
-    if ((_YEAR / 1000U) > 0)
-      _buffer[_index++] = (_YEAR / 1000U) + '0';              // Add The First Digit In Year
-    if (((_YEAR / 10U) / 10U) % 10U > 0 || (_YEAR / 1000U) > 0)
-      _buffer[_index++] = ((_YEAR / 10U) / 10U) % 10U + '0';  // Add The Second Digit In Year
-    if ((_YEAR / 10U) % 10U > 0 || ((_YEAR / 10U) / 10U) % 10U > 0)
-      _buffer[_index++] = (_YEAR / 10U) % 10U + '0';          // Add The Third Digit In Year
-    _buffer[_index++] = _YEAR % 10U + '0';                    // Add The Fourth Digit In Year
+    _index += _NAME ? AMN(_buffer + _index, _MONTH) : A2D(_buffer + _index, _MONTH, _USEDATEZERO_); // Add The Month
+    _buffer[_index++] = '/';                                  // Add The /
+    _index += AYR(_buffer + _index, _YEAR);                   // Add The Year
+  }
+  #else                                                       // Small - One Loop Over The Fields
+  // Field Order: 2.bits Per Field, First Field In The Low Bits. 0 = Day & 1 = Month & 2 = Year
+  uint8_t _order = DFO();                                     // Field Order
+  for (uint8_t _field = 0; _field < 3; _field++, _order >>= 2) {
+    if (_field > 0) _buffer[_index++] = '/';                  // Add The /
+    if ((_order & 3) == 0) _index += A2D(_buffer + _index, _DAY, _USEDATEZERO_); // Add The Day
+    else if ((_order & 3) == 2) _index += AYR(_buffer + _index, _YEAR);          // Add The Year
+    else if (_NAME) _index += AMN(_buffer + _index, _MONTH);                     // Add The Month Name
+    else _index += A2D(_buffer + _index, _MONTH, _USEDATEZERO_);                 // Add The Month
   }
+  #endif
 
   // Clock
   if (_TYPE == 0 || _TYPE == 1) {                             // Add The Clock
@@ -602,25 +763,16 @@ char* DateTimeFunctions::MTDTS(const uint8_t _DAY, const uint8_t _MONTH, const u
     _buffer[_index++] = '-';                                  // Add The -
     _buffer[_index++] = ' ';                                  // Add The Space
     // Hours
-    if (_CLOCKFORMAT_) {                                      // 24.Hours
-      if (_USEHOURZERO_ || _HOUR >= 10)                       // Add The First Digit
-        _buffer[_index++] = (_HOUR / 10) + '0';               // Add The First Digit In Hours
-      _buffer[_index++] = (_HOUR % 10) + '0';                 // Add The Second Digit In Hours
-    }
-    else {                                                    // 12.Hours
-      uint8_t _hour = con24To12(_HOUR);                       // Convert 24.h To 12.h
-      if (_USEHOURZERO_ || _hour >= 10)                       // Add The First Digit
-        _buffer[_index++] = (_hour / 10) + '0';               // Add The First Digit In Hours
-      _buffer[_index++] = (_hour % 10) + '0';                 // Add The Second Digit In Hours
-    }
+    if (_CLOCKFORMAT_)                                        // 24.Hours
+      _index += A2D(_buffer + _index, _HOUR, _USEHOURZERO_);  // Add The Hours
+    else                                                      // 12.Hours
+      _index += A2D(_buffer + _index, con24To12(_HOUR), _USEHOURZERO_); // Add The Hours - Convert 24.h To 12.h
     _buffer[_index++] = ':';                                  // Add The :
     // Minutes
-    _buffer[_index++] = (_MIN / 10) + '0';                    // Add The First Digit In Minutes
-    _buffer[_index++] = (_MIN % 10) + '0';                    // Add The Second Digit In Minutes
+    _index += A2D(_buffer + _index, _MIN, true);              // Add The Minutes
     _buffer[_index++] = ':';                                  // Add The :
     // Seconds
-    _buffer[_index++] = (_SEC / 10) + '0';                    // Add The First Digit In Seconds
-    _buffer[_index++] = (_SEC % 10) + '0';                    // Add The Second Digit In Seconds
+    _index += A2D(_buffer + _index, _SEC, true);              // Add The Seconds
     // AM / PM
     if (!_CLOCKFORMAT_) {                                     // Add The AM / PM
       _buffer[_index++] = ' ';                                // Add The Space
@@ -634,12 +786,76 @@ char* DateTimeFunctions::MTDTS(const uint8_t _DAY, const uint8_t _MONTH, const u
 
   // Null Terminate The String
   _buffer[_index] = '\0';                                     // Null Terminate The String
-  // Return The Time String
-  return _buffer;                                             // Return The Time String
+  // Return The Length
+  return _index;                                              // Return The Length
+}
+
+// Add Two Digits - Private - Returns: 1-2 (First Digit Only If _ZERO Or 10+)
+uint8_t DateTimeFunctions::A2D(char* _buffer, const uint8_t _IN, const bool _ZERO) {
+  #if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST        // Fast - Both Digits From The Table
+    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
+      _buffer[0] = PM(DIGITS2 + _IN * 2);                               // Add The First Digit
+      _buffer[1] = PM(DIGITS2 + _IN * 2 + 1);                           // Add The Second Digit
+    #else                                                               // Use SRAM
+      _buffer[0] = DIGITS2[_IN * 2];                                    // Add The First Digit
+      _buffer[1] = DIGITS2[_IN * 2 + 1];                                // Add The Second Digit
+    #endif
+    if (_ZERO || _IN >= 10) return 2;                                   // Both Digits
+    _buffer[0] = _buffer[1];                                            // Only The Second Digit
+    return 1;
+  #else                                                                 // Small - Divide
+    uint8_t _index = 0;                                                 // String Index
+    if (_ZERO || _IN >= 10) _buffer[_index++] = (_IN / 10) + '0';       // Add The First Digit
+    _buffer[_index++] = (_IN % 10) + '0';                               // Add The Second Digit
+    return _index;                                                      // Return The Length
+  #endif
+}
+
+// Add The Year - Private - Returns: 1-5 (No Leading Zeros)
+uint8_t DateTimeFunctions::AYR(char* _buffer, const uint16_t _YEAR) {
+  #if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST        // Fast - Two Digits At A Time
+    if (_YEAR >= 1000U && _YEAR < 10000U) {                             // YYYY - The Usual Case
+      const uint8_t _HIGH = _YEAR / 100U;                               // First Two Digits
+      A2D(_buffer, _HIGH, true);                                        // Add The First Two Digits
+      A2D(_buffer + 2, _YEAR - _HIGH * 100U, true);                     // Add The Last Two Digits
+      return 4;                                                         // Return The Length
+    }
+  #endif
+  // Any Year - Digits From The Top, Leading Zeros Skipped
+  uint8_t _index = 0;                                                   // String Index
+  if (_YEAR >= 10000U) _buffer[_index++] = (_YEAR / 10000U) + '0';      // Add The Ten Thousands
+  if (_YEAR >= 1000U) _buffer[_index++] = (_YEAR / 1000U) % 10U + '0';  // Add The Thousands
+  if (_YEAR >= 100U) _buffer[_index++] = (_YEAR / 100U) % 10U + '0';    // Add The Hundreds
+  if (_YEAR >= 10U) _buffer[_index++] = (_YEAR / 10U) % 10U + '0';      // Add The Tens
+  _buffer[_index++] = _YEAR % 10U + '0';                                // Add The Units
+  return _index;                                                        // Return The Length
+}
+
+// Add The Short Month Name - Private - Returns: 3
+uint8_t DateTimeFunctions::AMN(char* _buffer, const uint8_t _MONTH) {
+  #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                 // Use Flash
+    _buffer[0] = (char)PM(&(MONTHNAME_S[_MONTH - 1][0]));               // First Characters
+    _buffer[1] = (char)PM(&(MONTHNAME_S[_MONTH - 1][1]));               // Second Characters
+    _buffer[2] = (char)PM(&(MONTHNAME_S[_MONTH - 1][2]));               // Third Characters
+  #else                                                                 // Use SRAM
+    _buffer[0] = MONTHNAME_S[_MONTH - 1][0];                            // First Characters
+    _buffer[1] = MONTHNAME_S[_MONTH - 1][1];                            // Second Characters
+    _buffer[2] = MONTHNAME_S[_MONTH - 1][2];                            // Third Characters
+  #endif
+  return 3;                                                             // Return The Length
+}
+
+// Date Field Order - Private - Returns: 2.bits Per Field, First Field In The Low Bits. 0 = Day & 1 = Month & 2 = Year
+uint8_t DateTimeFunctions::DFO() {
+  if (_DATEFORMAT_ == 2) return 0x21;                                   // MM/DD/YYYY
+  else if (_DATEFORMAT_ == 3) return 0x06;                              // YYYY/MM/DD
+  else if (_DATEFORMAT_ == 4) return 0x12;                              // YYYY/DD/MM
+  return 0x24;                                                          // DD/MM/YYYY
 }
 
 // Convert Day Of Year To Date - conDOY2DATE(DOY, year, false/true) = Returns: DD/MM/YYYY Or DD/Jan/YYYY
 char* DateTimeFunctions::conDOY2DATE(const uint16_t _DOY, const uint16_t _YEAR, const bool _USEMONTHNAME) {
+  STAT(conDOY2DATE);
   // Convert Day Of Year To Date
   // Max String = DD/MMM/YYYY = 11.characters.
   // Variables
@@ -694,8 +910,19 @@ char* DateTimeFunctions::conDOY2DATE(const uint16_t _DOY, const uint16_t _YEAR,
   else return MTDTS(_day, _month, _YEAR, 0, 0, 0, 2);               // Use MTDTS() - Type 2
 }
 
+// Convert Day Of Year To Date - conDOY2DATE(doy, year, day, month) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conDOY2DATE(const uint16_t _DOY, const uint16_t _YEAR, uint8_t& _day, uint8_t& _month) {
+  STAT(conDOY2DATEChecked);
+  // Convert Day Of Year To Date - Checked, 1 ... 365 Or 366
+  if ((uint16_t)(_DOY - 1U) >= 365U + VDT(29, 2, _YEAR)) return false; // Wrong Day Of Year - 29/02 Is Valid In Leap Years
+  _month = conDOY2M(_DOY, _YEAR);                             // Set The Month
+  _day = conDOY2D(_DOY, _YEAR);                               // Set The Day
+  return true;                                                // Valid
+}
+
 // Convert Day Of Year To Day - conDOY2D(DOY, year) = Returns: 1-31
 uint8_t DateTimeFunctions::conDOY2D(const uint16_t _DOY, const uint16_t _YEAR) {
+  STAT(conDOY2D);
   // Convert Day Of Year To Day
   uint16_t _day   = 0U;                                           // Day Calculator
   uint8_t  _month = 0;                                            // Month Counter
@@ -750,6 +977,7 @@ uint8_t DateTimeFunctions::conDOY2D(const uint16_t _DOY, const uint16_t _YEAR) {
 
 // Convert Day Of Year To Month - conDOY2M(DOY, year) = Returns: 1-12
 uint8_t DateTimeFunctions::conDOY2M(const uint16_t _DOY, const uint16_t _YEAR) {
+  STAT(conDOY2M);
   // Convert Day Of Year To Month
   uint16_t _day = 0U;                                             // Day Calculator
   uint8_t  _month = 0;                                            // Month Counter
@@ -782,6 +1010,7 @@ uint8_t DateTimeFunctions::conDOY2M(const uint16_t _DOY, const uint16_t _YEAR) {
 
 // Convert Date Time To Unix Time - conDT2UT(day, month, year, hour, minute, second) = Returns: Seconds Elapsed Since 01/01/1970 - 00:00:00 UTC
 uint32_t DateTimeFunctions::conDT2UT(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC) {  // Calculate Unix Time
+  STAT(conDT2UT);
   // Convert Date Time To Unix Time
   const uint16_t _DOY = getDOY(_DAY, _MONTH, _YEAR);       // Get Day Of The Year
   uint8_t _leapYearDay = 0;                                // Dont Subtract One Day Of The Year
@@ -792,99 +1021,152 @@ uint32_t DateTimeFunctions::conDT2UT(const uint8_t _DAY, const uint8_t _MONTH, c
   return (_SECONDS_FROM_1970_TO_2000 + ((((((_YEAR - 2000UL) * _SECINONEYEAR) + _DOY * 86400UL) + _HOUR * 3600UL) + _MIN * 60UL) + _SEC) + (((_YEAR - 2000UL) / 4UL) * 86400UL)) - (_leapYearDay * 86400UL);
 }
 
+// Convert Date Time To Unix Time - conDT2UT(day, month, year, hour, minute, second, unixTime) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conDT2UT(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, uint32_t& _unixTime) {
+  STAT(conDT2UTChecked);
+  // Convert Date Time To Unix Time - Checked, 01/01/1970 - 00:00:00 ... 07/02/2106 - 06:28:15
+  if (!(VDT(_DAY, _MONTH, _YEAR) & VTM(_HOUR, _MIN, _SEC)) || _YEAR < 1970U) return false; // Wrong Date Time
+  const uint64_t _UT = (uint64_t)(conGre2JDN(_DAY, _MONTH, _YEAR) - 2440588L) * 86400ULL + _HOUR * 3600UL + _MIN * 60U + _SEC;
+  if (_UT > 0xFFFFFFFFULL) return false;                      // After 07/02/2106 - 06:28:15
+  _unixTime = (uint32_t)_UT;                                  // Set The Unix Time
+  return true;                                                // Valid
+}
+
 // Convert Unix Time To Date Time - conUT2DT(unixTime, false/true) = Returns: DD/MM/YYYY - HH:MM:SS Or DD/Jan/YYYY - HH:MM:SS
 char* DateTimeFunctions::conUT2DT(const uint64_t _UNIXTIME, const bool _USEMONTHNAME) {
+  STAT(conUT2DT);
   // Convert Unix Time To Human Readable Format
   // Max String = DD/MMM/YYYY - HH:MM:SS = 22.characters.
-  // Variables
-  int32_t _extraDays = 0L;                                    // DOY
-  uint32_t _daysTillNow = _UNIXTIME / 86400UL;                // Days / Year Calculate
-  const uint32_t _TOTALSEC = _UNIXTIME % 86400UL;             // Total Seconds In Current Day
-  uint16_t _year = 1970U;                                     // Year (Unix Time Starts At 01/01/1970)
-  uint8_t _day = 0, _month = 0;                               // Day & Month
-  uint8_t _leapYearFlag = 0, _index = 0;                      // Leap Year Flag, Month Index
-
-  // Calculate Current Year
-  while (true) {
-    if (_year % 400U == 0U || (_year % 4U == 0U && _year % 100U != 0U)) {
-      if (_daysTillNow < 366UL) break;
-      _daysTillNow -= 366UL;
-    }
-    else {
-      if (_daysTillNow < 365UL) break;
-      _daysTillNow -= 365UL;
-    }
-    _year++;
-  }
-  // Updating extradays because it will give days till previous day and we have to include the current day.
-  _extraDays = _daysTillNow + 1L;
+  return conUT2DT(__dateTimeStaticBuffer, _UNIXTIME, _USEMONTHNAME); // Use conUT2DT() - Static Buffer
+}
 
-  // Check For Leap Year
-  if (_year % 400U == 0U || (_year % 4U == 0U && _year % 100U != 0U)) _leapYearFlag = 1;
-
-  // Calculate Month & DOY
-  if (_leapYearFlag == 1) {
-    while (true) {
-      if (_index == 1) {
-        if (_extraDays - 29L < 0L) break;
-        _month++;                                             // Add To Month
-        _extraDays -= 29L;                                    // Subtract Of extraDays
-      }
+// Convert Unix Time To Date Time - conUT2DT(buffer, unixTime, false/true) = Returns: DD/MM/YYYY - HH:MM:SS Or DD/Jan/YYYY - HH:MM:SS
+char* DateTimeFunctions::conUT2DT(char* _BUFFER, const uint64_t _UNIXTIME, const bool _USEMONTHNAME) {
+  STAT(conUT2DTBuf);
+  // Convert Unix Time To Human Readable Format - Into The Caller Buffer
+  // _BUFFER needs to be 27.bytes. No static state is written, so threads can share one object.
+  uint8_t _day, _month, _hour, _min, _sec;                    // Date Time Fields
+  uint16_t _year;                                             // Year
+  UT2F(_UNIXTIME, _day, _month, _year, _hour, _min, _sec);    // Split The Unix Time
+
+  // Make The String - DD/MM/YYYY - HH:MM:SS
+  if (_USEMONTHNAME) return MTDTS(_BUFFER, _day, _month, _year, _hour, _min, _sec, 1); // Use MTDTS() - Type 1
+  else return MTDTS(_BUFFER, _day, _month, _year, _hour, _min, _sec, 0);               // Use MTDTS() - Type 0
+}
+
+// Convert Unix Time To Date Time - conUT2DT(unixTime, day, month, year, hour, min, sec) = Sets: The Date Time Fields
+void DateTimeFunctions::conUT2DT(const uint64_t _UNIXTIME, uint8_t& _day, uint8_t& _month, uint16_t& _year, uint8_t& _hour, uint8_t& _min, uint8_t& _sec) {
+  STAT(conUT2DTFields);
+  // Convert Unix Time To Date Time Fields - No String Is Made
+  UT2F(_UNIXTIME, _day, _month, _year, _hour, _min, _sec);    // Split The Unix Time
+}
+
+// Convert Array Of Unix Time To Date Time - conUT2DT(DATETIMEFUNCTIONS_FORMAT_ISO, in, out, count, size, ',', offsets) = Returns: Timestamps Written
+uint16_t DateTimeFunctions::conUT2DT(const uint8_t _FORMAT, const uint64_t* _IN, char* _out, const uint16_t _COUNT, const uint32_t _SIZE, const char _SEP, uint32_t* _offsets) {
+  STAT(conUT2DTBatch);
+  // All timestamps go one after the other into _out, with _SEP between them & a null at the end.
+  // _SEP = '\0' makes each one its own string. _offsets (If Not NULL, _COUNT + 1 words) gets the start
+  // of each timestamp & the end of the last. Stops when the next one, its separator & the null
+  // might not fit in _SIZE, and for ISO at a year past 9999.
+  // The date is only worked out when the day changes, else the ISO date part is copied.
+  if (_SIZE == 0) return 0;                                   // No Room
+  const uint8_t _WIDTH = getFormatWidth(_FORMAT);             // Fixed Width - 0 = Not Fixed
+  const bool _ISO = (_FORMAT == DATETIMEFUNCTIONS_FORMAT_ISO); // ISO 8601
+  uint32_t _at = 0;                                           // Write Position
+  uint32_t _lastDay = 0xFFFFFFFFUL;                           // Day Of The Last Timestamp
+  uint32_t _lastAt = 0;                                       // Start Of The Last Timestamp
+  uint8_t _day = 1, _month = 1, _hour, _min, _sec;            // Date Time Fields
+  uint16_t _year = 1970;                                      // Year
+  uint16_t _i = 0;                                            // Timestamp
+  for (; _i < _COUNT; _i++) {
+    const uint64_t _T = _IN[_i];                              // Unix Time
+    if (_ISO && _T >= 253402300800ULL) break;                 // ISO Stops After 9999
+    const uint8_t _MAXW = (_WIDTH && _T < 253402300800ULL) ? _WIDTH : DATETIMEFUNCTIONS_FORMAT_MAX; // Widest This One Can Be
+    if (_at + (_i > 0 ? 1U : 0U) + _MAXW + 1U > _SIZE) break; // Separator, Timestamp & Null Must Fit
+    if (_i > 0) _out[_at++] = _SEP;                           // Add The Separator
+    if (_offsets) _offsets[_i] = _at;                         // Start Of The Timestamp
+    const uint32_t _DAYS = (uint32_t)(_T / 86400ULL);         // Days Since 01/01/1970
+    const uint32_t _TOTALSEC = (uint32_t)(_T - (uint64_t)_DAYS * 86400ULL); // Seconds In The Day
+    _hour = (uint8_t)((_TOTALSEC * 37283UL) >> 27);           // Hours   (/ 3600)
+    const uint16_t _REST = _TOTALSEC - _hour * 3600UL;        // Seconds In The Hour
+    _min = (uint8_t)((_REST * 2185UL) >> 17);                 // Minutes (/ 60)
+    _sec = (uint8_t)(_REST - _min * 60U);                     // Seconds
+    const bool _SAMEDAY = (_DAYS == _lastDay);                // Same Day As The Last One
+    if (!_SAMEDAY) {                                          // New Day - Split It
+      uint8_t _h, _m, _s;                                     // Midnight - Not Used
+      UT2F((uint64_t)_DAYS * 86400ULL, _day, _month, _year, _h, _m, _s); // Split The Day
+    }
+    if (_ISO) {                                               // YYYY-MM-DDTHH:MM:SSZ
+      char* _p = _out + _at;                                  // Write Pointer
+      if (_SAMEDAY) memcpy(_p, _out + _lastAt, 11);           // Same Date - Copy It
       else {
-        #if DATETIMEFUNCTIONS_MEMORY_USE == 0                 // Use Flash
-          if (_extraDays - PM(DIM_N + _index) < 0L) break;    // Use Flash Memory
-          _month++;                                           // Add To Month
-          _extraDays -= PM(DIM_N + _index);                   // Use Flash Memory
-        #else                                                 // Use SRAM
-          if (_extraDays - DIM_N[_index] < 0L) break;         // Use SRAM Memory
-          _month++;                                           // Add To Month
-          _extraDays -= DIM_N[_index];                        // Use SRAM Memory
-        #endif
+        A2D(_p, _year / 100U, true); A2D(_p + 2, _year % 100U, true); // Add The Year
+        _p[4] = '-'; A2D(_p + 5, _month, true);               // Add The Month
+        _p[7] = '-'; A2D(_p + 8, _day, true);                 // Add The Day
+        _p[10] = 'T';                                         // Add The T
       }
-      _index++;                                               // Add To Index
-    }
-  }
-  else {
-    while (true) {
-      #if DATETIMEFUNCTIONS_MEMORY_USE == 0                   // Use Flash
-        if (_extraDays - PM(DIM_N + _index) < 0L) break;      // Use Flash Memory
-        _month++;                                             // Add To Month
-        _extraDays -= PM(DIM_N + _index);                     // Use Flash Memory
-      #else                                                   // Use SRAM
-        if (_extraDays - DIM_N[_index] < 0L) break;           // Use SRAM Memory
-        _month++;                                             // Add To Month
-        _extraDays -= DIM_N[_index];                          // Use SRAM Memory
-      #endif
-      _index++;                                               // Add To Index
+      A2D(_p + 11, _hour, true); _p[13] = ':';                // Add The Hours
+      A2D(_p + 14, _min, true); _p[16] = ':';                 // Add The Minutes
+      A2D(_p + 17, _sec, true); _p[19] = 'Z';                 // Add The Seconds & The Z
+      _lastAt = _at;                                          // Start Of This One
+      _at += 20;                                              // Next Position
     }
+    else _at += MTS(_out + _at, _day, _month, _year, _hour, _min, _sec, _FORMAT); // Date Time String
+    _lastDay = _DAYS;                                         // Day Of This One
   }
+  _out[_at] = '\0';                                           // Null Terminate
+  if (_offsets) _offsets[_i] = _at;                           // End Of The Last Timestamp
+  return _i;                                                  // Return The Timestamps Written
+}
 
-  // Current Month & Day
-  if (_extraDays > 0L) {
-    _month++;                                                 // Add To Month
-    _day = _extraDays;                                        // Set The Day
-  }
-  else {
-    if (_month == 2 && _leapYearFlag == 1) _day = 29;         // Set The Day
-    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                     // Use Flash
-      else _day = PM(DIM_N + _month - 1);                     // Use Flash Memory
-    #else                                                     // Use SRAM
-      else _day = DIM_N[_month - 1];                          // Use SRAM Memory
-    #endif
-  }
-
-  // Calculate Hours, Minutes & Seconds
-  const uint8_t _HOURS   = _TOTALSEC / 3600UL;                // Hours
-  const uint8_t _MINUTES = (_TOTALSEC % 3600UL) / 60UL;       // Minutes
-  const uint8_t _SECONDS = _TOTALSEC % 60UL;                  // Seconds
-
-  // Make The String - DD/MM/YYYY - HH:MM:SS
-  if (_USEMONTHNAME) return MTDTS(_day, _month, _year, _HOURS, _MINUTES, _SECONDS, 1); // Use MTDTS() - Type 1
-  else return MTDTS(_day, _month, _year, _HOURS, _MINUTES, _SECONDS, 0);               // Use MTDTS() - Type 0
+// Split Unix Time To Date Time Fields - Private
+void DateTimeFunctions::UT2F(const uint64_t _UNIXTIME, uint8_t& _day, uint8_t& _month, uint16_t& _year, uint8_t& _hour, uint8_t& _min, uint8_t& _sec) {
+  // Split Unix Time To Day, Month, Year, Hour, Minute & Second - No Loops, Same Result For Both Profiles
+  #if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST        // Fast - Neri-Schneider, Multiply & Shift
+    // Days: 86400 = 128 * 675, So Below 2^39 Seconds (Year 19391) It Is One 32.bit Division
+    const uint32_t _DAYS = (_UNIXTIME < (1ULL << 39)) ? (uint32_t)(_UNIXTIME >> 7) / 675UL : (uint32_t)(_UNIXTIME / 86400ULL);
+    const uint32_t _TOTALSEC = (uint32_t)(_UNIXTIME - (uint64_t)_DAYS * 86400ULL); // Total Seconds In Current Day
+    // Shift The Days So The Year Starts At 01/03 And Every Value Is Positive (82 * 400.years)
+    const uint32_t _N = _DAYS + 719468UL + 146097UL * 82UL;             // Days Since 01/03/-32800
+    const uint32_t _N1 = 4UL * _N + 3UL;                                // Centuries
+    const uint32_t _C = _N1 / 146097UL;                                 // Century
+    const uint32_t _N2 = (_N1 % 146097UL) | 3UL;                        // Days In Century * 4 + 3
+    const uint64_t _P2 = 2939745ULL * _N2;                              // Years: High 32.bits, Day Of Year: Low 32.bits
+    const uint32_t _Z = (uint32_t)(_P2 >> 32);                          // Year In Century
+    const uint32_t _NY = (uint32_t)_P2 / 2939745UL / 4UL;               // Day Of Year (From 01/03)
+    const uint32_t _N3 = 2141UL * _NY + 197913UL;                       // Month & Day
+    const uint8_t _J = (_NY >= 306UL);                                  // January Or February
+    _year = (uint16_t)(100UL * _C + _Z - 400UL * 82UL + _J);            // Year
+    _month = (uint8_t)((_N3 >> 16) - (_J ? 12U : 0U));                  // Month
+    _day = (uint8_t)((_N3 & 0xFFFFUL) / 2141UL + 1UL);                  // Day
+    // Calculate Hours, Minutes & Seconds - Multiply & Shift
+    _hour = (uint8_t)((_TOTALSEC * 37283UL) >> 27);                     // Hours   (/ 3600)
+    const uint16_t _REST = _TOTALSEC - _hour * 3600UL;                  // Seconds In Current Hour
+    _min  = (uint8_t)((_REST * 2185UL) >> 17);                          // Minutes (/ 60)
+    _sec  = (uint8_t)(_REST - _min * 60U);                              // Seconds
+  #else                                                                 // Small - Days From Civil, Divisions
+    const uint32_t _DAYS = _UNIXTIME / 86400UL;                         // Days Since 01/01/1970
+    const uint32_t _TOTALSEC = _UNIXTIME % 86400UL;                     // Total Seconds In Current Day
+    // The Year Starts At 01/03, So The Leap Day Is The Last Day Of The Year
+    const uint32_t _Z = _DAYS + 719468UL;                               // Days Since 01/03/0000
+    const uint32_t _ERA = _Z / 146097UL;                                // 400.Year Era
+    const uint32_t _DOE = _Z - _ERA * 146097UL;                         // Day Of Era   [0, 146096]
+    const uint32_t _YOE = (_DOE - _DOE / 1460UL + _DOE / 36524UL - _DOE / 146096UL) / 365UL; // Year Of Era [0, 399]
+    const uint16_t _DOY = _DOE - (365UL * _YOE + _YOE / 4UL - _YOE / 100UL); // Day Of Year  [0, 365]
+    const uint8_t _MP = (5U * _DOY + 2U) / 153U;                        // Month From March [0, 11]
+    _day = _DOY - (153U * _MP + 2U) / 5U + 1U;                          // Day
+    _month = (_MP < 10U) ? _MP + 3U : _MP - 9U;                         // Month
+    _year = _YOE + _ERA * 400UL + (_month <= 2U);                       // Year
+    // Calculate Hours, Minutes & Seconds
+    _hour = _TOTALSEC / 3600UL;                                         // Hours
+    _min  = (_TOTALSEC % 3600UL) / 60UL;                                // Minutes
+    _sec  = _TOTALSEC % 60UL;                                           // Seconds
+  #endif
 }
 
 // Convert Seconds To Time - conSec2Time(uint32_t seconds) = Returns: X.year, X.days, X.hours, X.min, X.sec
 char* DateTimeFunctions::conSec2Time(const uint32_t _SEC) {
+  STAT(conSec2Time);
   // Convert Seconds To Time
   // Max Value  = 136.years, 70.days, 6.hours, 28.min, 15.sec
   // Max String = 135.years, 364.days, 23.hours, 59.min, 59.sec = 45.characters.
@@ -961,6 +1243,7 @@ char* DateTimeFunctions::conSec2Time(const uint32_t _SEC) {
 
 // Convert Seconds To Time - conSec2Time(uint64_t seconds) = Returns: X.year, X.days, X.hours, X.min, X.sec
 char* DateTimeFunctions::conSec2Time64(const uint64_t _SEC) {
+  STAT(conSec2Time64);
   // Convert Seconds To Time
   // Uint64 Max: 18446744073709551615.sec =
   // Max String: 584942417355.years, 26.days, 7.hours, 0.min, 15.sec = Max: 53.characters.
@@ -1056,8 +1339,208 @@ char* DateTimeFunctions::conSec2Time64(const uint64_t _SEC) {
   return _buffer;                                           // Return The String
 }
 
+// Convert Seconds To Duration - conSec2Dur(seconds, duration, false/true) = Sets: duration
+void DateTimeFunctions::conSec2Dur(const uint64_t _SEC, DateTimeDuration& _dur, const bool _USEYEARS) {
+  STAT(conSec2Dur);
+  // Convert Seconds To Duration - One Split, No 64.bit Division For Less Than 17421.years
+  // Days: 86400 = 128 * 675, so (seconds >> 7) / 675 is the days and fits 32.bits up to 2^39.seconds.
+  // Hours & minutes use multiply & shift in place of division: n / 3600 = (n * 37283) >> 27 for n < 86400
+  // and n / 60 = (n * 2185) >> 17 for n < 3600. Years are 365.days, and only used if _USEYEARS is true.
+  uint32_t _days;                                                    // Days
+  if ((_SEC >> 39) == 0ULL) _days = (uint32_t)(_SEC >> 7) / 675UL;   // 32.bit Division
+  else if (_SEC / 86400ULL > 0xFFFFFFFFULL) _days = 0xFFFFFFFFUL;    // Max 4294967295.days
+  else _days = _SEC / 86400ULL;                                      // 64.bit Division
+  uint32_t _sod = (uint32_t)(_SEC - (uint64_t)_days * 86400ULL);     // Seconds Of Day
+  if (_sod >= 86400UL) _sod = 86399UL;                               // Only At Max Days
+  const uint32_t _HOURS = (_sod * 37283UL) >> 27;                    // Hours   = _sod / 3600
+  const uint32_t _REST = _sod - _HOURS * 3600UL;                     // Seconds Of Hour
+  const uint32_t _MINUTES = (_REST * 2185UL) >> 17;                  // Minutes = _REST / 60
+  _dur.hours   = _HOURS;                                             // Set The Hours
+  _dur.minutes = _MINUTES;                                           // Set The Minutes
+  _dur.seconds = _REST - _MINUTES * 60UL;                            // Set The Seconds
+  _dur.millis  = 0U;                                                 // Set The Millis
+  if (_USEYEARS) {                                                   // Split The Years
+    _dur.years = _days / 365UL;                                      // Set The Years
+    _dur.days  = _days - _dur.years * 365UL;                         // Set The Days
+  }
+  else {                                                             // Only Days
+    _dur.years = 0UL;                                                // No Years
+    _dur.days  = _days;                                              // Set The Days
+  }
+}
+
+// Convert Milliseconds To Duration - conMs2Dur(milliseconds, duration, false/true) = Sets: duration
+void DateTimeFunctions::conMs2Dur(const uint64_t _MILLIS, DateTimeDuration& _dur, const bool _USEYEARS) {
+  STAT(conMs2Dur);
+  // Convert Milliseconds To Duration
+  // Seconds: 1000 = 8 * 125, so (millis >> 3) / 125 fits 32.bits up to 2^35.ms (397.days).
+  uint64_t _sec;                                                     // Seconds
+  if ((_MILLIS >> 35) == 0ULL) _sec = (uint32_t)(_MILLIS >> 3) / 125UL; // 32.bit Division
+  else _sec = _MILLIS / 1000ULL;                                     // 64.bit Division
+  conSec2Dur(_sec, _dur, _USEYEARS);                                 // Split The Seconds
+  _dur.millis = (uint16_t)(_MILLIS - _sec * 1000ULL);                // Set The Millis
+}
+
+// Convert ISO 8601 Duration To Milliseconds - conISO2Ms("P1Y2DT3H4M5.5S", millis) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conISO2Ms(const char* _IN, uint64_t& _millis) {
+  STAT(conISO2Ms);
+  // Convert ISO 8601 Duration To Milliseconds
+  // https://en.wikipedia.org/wiki/ISO_8601#Durations
+  // Takes: PnYnWnDTnHnMnS - The parts need to be in this order and only seconds can have a fraction.
+  // Y = 365.days & W = 7.days. Months (P1M) have no fixed length, so they are not valid here.
+  // A total past 2^64-1 milliseconds (584942417.years) is not valid.
+  const uint64_t _UNITMS[6] = {31536000000ULL, 604800000ULL, 86400000ULL, 3600000ULL, 60000ULL, 1000ULL}; // Y, W, D, H, M, S
+  size_t _i = 0;                                                     // String Index - Any Length
+  uint8_t _next = 0;                                                 // Next Allowed Unit (Y = 0 ... S = 5)
+  bool _time = false;                                                // After The T
+  bool _any = false;                                                 // Got At Least One Part
+  uint64_t _total = 0ULL;                                            // Total Milliseconds
+  if (_IN == NULL || _IN[_i++] != 'P') return false;                 // Needs To Start With P
+  while (_IN[_i] != '\0') {
+    // Time Part
+    if (_IN[_i] == 'T') {                                            // Start Of Time Part
+      if (_time || _IN[_i + 1] == '\0') return false;               // Only One T & Something After It
+      _time = true; _next = 3; _i++;                                 // Hours Or Later
+      continue;
+    }
+    // Number
+    uint64_t _num = 0ULL;                                            // Number
+    uint8_t _digits = 0;                                             // Digit Count
+    while (_IN[_i] >= '0' && _IN[_i] <= '9') {                       // Read The Digits
+      if (++_digits > 12) return false;                              // To Big
+      _num = _num * 10ULL + (_IN[_i++] - '0');                       // Add The Digit
+    }
+    uint16_t _frac = 0U;                                             // Fraction In Millis
+    if (_IN[_i] == '.' || _IN[_i] == ',') {                          // Fraction
+      uint16_t _scale = 100U;                                        // First Digit = 100.ms
+      _i++;                                                          // Skip The . Or ,
+      if (_IN[_i] < '0' || _IN[_i] > '9') return false;              // Needs A Digit
+      for (; _IN[_i] >= '0' && _IN[_i] <= '9'; _i++, _scale /= 10U) _frac += (_IN[_i] - '0') * _scale;
+      if (_IN[_i] != 'S') return false;                              // Only Seconds Can Have A Fraction
+    }
+    if (_digits == 0) return false;                                  // Needs A Number
+    // Unit
+    uint8_t _unit;                                                   // Unit Index
+    const char _C = _IN[_i++];                                       // Unit Letter
+    if (!_time && _C == 'Y') _unit = 0;                              // Years
+    else if (!_time && _C == 'W') _unit = 1;                         // Weeks
+    else if (!_time && _C == 'D') _unit = 2;                         // Days
+    else if (_time && _C == 'H') _unit = 3;                          // Hours
+    else if (_time && _C == 'M') _unit = 4;                          // Minutes
+    else if (_time && _C == 'S') _unit = 5;                          // Seconds
+    else return false;                                               // Unknown Or Months
+    if (_unit < _next) return false;                                 // Wrong Order
+    _next = _unit + 1;                                               // Next Allowed Unit
+    const uint64_t _ROOM = 0xFFFFFFFFFFFFFFFFULL - _total;          // Milliseconds Left Before Overflow
+    if (_frac > _ROOM || _num > (_ROOM - _frac) / _UNITMS[_unit]) return false; // To Big
+    _total += _num * _UNITMS[_unit] + _frac;                         // Add The Part
+    _any = true;                                                     // Got A Part
+  }
+  if (!_any) return false;                                           // Just "P"
+  _millis = _total;                                                  // Set The Milliseconds
+  return true;                                                       // Valid
+}
+
+// Convert ISO 8601 Timestamp To Unix Time - conISO2UT("2023-11-14T22:13:20Z", unixTime) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conISO2UT(const char* _IN, uint64_t& _unixTime) {
+  STAT(conISO2UT);
+  uint16_t _millis;                                                  // Not Used
+  return I2U(_IN, _unixTime, _millis);                               // Use I2U()
+}
+
+// Convert ISO 8601 Timestamp To Unix Time & Millis - conISO2UT("2023-11-14T22:13:20.250Z", unixTime, millis) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conISO2UT(const char* _IN, uint64_t& _unixTime, uint16_t& _millis) {
+  STAT(conISO2UTMs);
+  return I2U(_IN, _unixTime, _millis);                               // Use I2U()
+}
+
+// Convert Array Of ISO 8601 Timestamps To Unix Time - conISO2UT(in, out, count, mask) = Returns: Valid Timestamps
+uint16_t DateTimeFunctions::conISO2UT(const char* const* _IN, uint64_t* _OUT, const uint16_t _COUNT, uint32_t* _mask) {
+  STAT(conISO2UTBatch);
+  // Batch - Bit (i & 31) Of _mask[i / 32] Is Set If Timestamp i Is Valid, Else _OUT[i] = 0. _mask needs (_COUNT + 31) / 32 words.
+  uint16_t _valid = 0U;                                              // Valid Timestamps
+  uint32_t _word = 0UL;                                              // Mask Word
+  uint16_t _millis;                                                  // Not Used
+  for (uint16_t _i = 0U; _i < _COUNT; _i++) {
+    const uint8_t _OK = I2U(_IN[_i], _OUT[_i], _millis);             // Convert
+    if (!_OK) _OUT[_i] = 0ULL;                                       // Not Valid
+    _valid += _OK;                                                   // Count The Valid
+    _word |= (uint32_t)_OK << (_i & 31U);                            // Set The Bit
+    if ((_i & 31U) == 31U || _i + 1U == _COUNT) {                    // Word Done
+      _mask[_i >> 5] = _word;                                        // Set The Mask Word
+      _word = 0UL;                                                   // Next Word
+    }
+  }
+  return _valid;                                                     // Return The Valid Timestamps
+}
+
+// ISO 8601 Timestamp To Unix Time & Millis - Private - Returns: true If Valid "0-1"
+bool DateTimeFunctions::I2U(const char* _IN, uint64_t& _unixTime, uint16_t& _millis) {
+  // Takes: YYYY-MM-DDTHH:MM:SSZ Or YYYY-MM-DDTHH:MM:SS.fffZ (1-9 fraction digits, millis from the first 3).
+  // Reading stops after the Z, so it can be followed by the rest of a log line. 1970 and up, :60 is taken.
+  if (_IN == NULL) return false;                                     // No String
+  uint16_t _year;                                                    // Year
+  uint8_t _month, _day, _hour, _min, _sec;                           // Date Time Fields
+  #if DATETIMEFUNCTIONS_ISO_SIMD                                     // SSE - Both 16.byte Loads Stay In The First 20.bytes
+  if (strnlen(_IN, 20) >= 20U) {                                     // 20.bytes To Load - A Shorter String Is Done Byte By Byte
+    // XOR with the layout turns digits into 0-9 and the separators into 0, so one unsigned
+    // max(x, limit) == limit checks all 16.bytes. A: bytes 0-15 & B: bytes 4-19.
+    const __m128i _A = _mm_xor_si128(_mm_loadu_si128((const __m128i*)_IN), _mm_setr_epi8('0', '0', '0', '0', '-', '0', '0', '-', '0', '0', 'T', '0', '0', ':', '0', '0'));
+    const __m128i _B = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(_IN + 4)), _mm_setr_epi8('-', '0', '0', '-', '0', '0', 'T', '0', '0', ':', '0', '0', ':', '0', '0', 0));
+    const __m128i _LA = _mm_setr_epi8(9, 9, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9); // Limits Of A
+    const __m128i _LB = _mm_setr_epi8(0, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9, 0, 9, 9, -1); // Limits Of B - Byte 19 Is Checked Below
+    const __m128i _OK = _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(_A, _LA), _LA), _mm_cmpeq_epi8(_mm_max_epu8(_B, _LB), _LB));
+    if (_mm_movemask_epi8(_OK) != 0xFFFF) return false;              // Not The Layout
+    // The 14.digits In A Row (The Seconds From B), Then 10 * First + Second Per Pair
+    const __m128i _D = _mm_or_si128(_mm_shuffle_epi8(_A, _mm_setr_epi8(0, 1, 2, 3, 5, 6, 8, 9, 11, 12, 14, 15, -1, -1, -1, -1)),
+                                    _mm_shuffle_epi8(_B, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13, 14, -1, -1)));
+    const __m128i _P = _mm_maddubs_epi16(_D, _mm_set1_epi16(0x010A)); // YY, YY, MM, DD, HH, MM, SS, 0
+    _year = _mm_extract_epi16(_P, 0) * 100U + _mm_extract_epi16(_P, 1); // Year
+    _month = _mm_extract_epi16(_P, 2); _day = _mm_extract_epi16(_P, 3); // Month & Day
+    _hour = _mm_extract_epi16(_P, 4); _min = _mm_extract_epi16(_P, 5); _sec = _mm_extract_epi16(_P, 6); // Hour, Minute & Second
+  }
+  else
+  #endif
+  {                                                                  // Scalar - Byte By Byte
+    static const char _LAYOUT[] = "0000-00-00T00:00:00";             // 0 = Digit
+    uint8_t _d[14];                                                  // Digits
+    for (uint8_t _i = 0, _n = 0; _i < 19; _i++) {
+      const uint8_t _C = (uint8_t)_IN[_i];                           // The Character - Stops At The '\0'
+      if (_LAYOUT[_i] == '0') {                                      // Digit
+        if ((uint8_t)(_C - '0') > 9U) return false;                  // Not A Digit
+        _d[_n++] = _C - '0';                                         // Add The Digit
+      }
+      else if (_C != (uint8_t)_LAYOUT[_i]) return false;             // Not The Separator
+    }
+    _year = _d[0] * 1000U + _d[1] * 100U + _d[2] * 10U + _d[3];      // Year
+    _month = _d[4] * 10U + _d[5]; _day = _d[6] * 10U + _d[7];        // Month & Day
+    _hour = _d[8] * 10U + _d[9]; _min = _d[10] * 10U + _d[11]; _sec = _d[12] * 10U + _d[13]; // Hour, Minute & Second
+  }
+  // Fraction & Z
+  uint8_t _i = 19;                                                   // String Index
+  _millis = 0;                                                       // No Fraction
+  if (_IN[_i] == '.' && (uint8_t)(_IN[20] - '0') <= 9U && (uint8_t)(_IN[21] - '0') <= 9U && (uint8_t)(_IN[22] - '0') <= 9U && _IN[23] == 'Z') { // .fffZ - The Usual Case
+    _millis = (_IN[20] - '0') * 100U + (_IN[21] - '0') * 10U + (_IN[22] - '0'); // Millis
+    _i = 23;                                                         // At The Z
+  }
+  else if (_IN[_i] == '.') {                                         // Fraction - 1-9 Digits
+    uint8_t _n = 0;                                                  // Fraction Digits
+    for (_i++; (uint8_t)(_IN[_i] - '0') <= 9U && _n < 9; _i++, _n++)
+      if (_n < 3) _millis = _millis * 10U + (_IN[_i] - '0');         // Millis From The First 3
+    if (_n == 0) return false;                                       // Needs A Digit
+    for (; _n < 3; _n++) _millis *= 10U;                             // .5 = 500.ms
+  }
+  if (_IN[_i] != 'Z') return false;                                  // Needs The Z
+  if (!(VDT(_day, _month, _year) & VTM(_hour, _min, _sec)) || _year < 1970U) return false; // Not A Valid Date Time
+  // Days Since 01/01/1970 From The Closed Form Day Number Of Day 1 Of The Month
+  const uint32_t _DAYS = DFC(_year, _month) + _day - 1UL - 719468UL; // Days Since 01/01/1970
+  _unixTime = (uint64_t)_DAYS * 86400ULL + _hour * 3600UL + _min * 60U + _sec; // Set The Unix Time
+  return true;                                                       // Valid
+}
+
 // Convert Seconds To Date Time - conSec2DT(seconds, false/true) = Returns: DD/MM/YYYY - HH:MM:SS Or DD/Jan/YYYY - HH:MM:SS
 char* DateTimeFunctions::conSec2DT(const uint64_t _SEC, const bool _USEMONTHNAME) {
+  STAT(conSec2DT);
   // Convert Seconds To Date Time - DD/MM/YYYY - HH:MM:SS
   // 32.bit Max: 136.years, 70.days, 6.hours, 28.min, 15.sec
   // 64.bit Max: 584942417355.years, 26.days, 7.hours, 0.min, 15.sec
@@ -1121,6 +1604,7 @@ char* DateTimeFunctions::conSec2DT(const uint64_t _SEC, const bool _USEMONTHNAME
 
 // Convert Seconds To Date Time - conSec2DT(seconds, year, false/true) = Returns: DD/MM/YYYY - HH:MM:SS Or DD/Jan/YYYY - HH:MM:SS
 char* DateTimeFunctions::conSec2DT(const uint32_t _SEC, const uint16_t _YEAR, const bool _USEMONTHNAME) {
+  STAT(conSec2DTYear);
   // Convert Seconds To Date Time
   // Max String = DD/MMM/YYYY - HH:MM:SS = 22.characters.
   const uint32_t _LEAPDAYS = 86400UL * (((_YEAR - 4UL) - 1970UL) / 4UL);
@@ -1130,6 +1614,7 @@ char* DateTimeFunctions::conSec2DT(const uint32_t _SEC, const uint16_t _YEAR, co
 
 // Convert Date Time To Seconds - conDT2Sec(day, month, year, hour, min, sec) = Returns: uint32_t
 uint32_t DateTimeFunctions::conDT2Sec(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint32_t _HOUR, const uint32_t _MIN, const uint8_t _SEC) {
+  STAT(conDT2Sec);
   // Convert Date Time To Seconds
   // Max Value  = 51909555.Seconds
   uint16_t _m2Days = 0U;                                                  // Days In Month + Days
@@ -1153,6 +1638,7 @@ uint32_t DateTimeFunctions::conDT2Sec(const uint8_t _DAY, const uint8_t _MONTH,
 
 // Convert Days, Years, Hours, Minutes And Seconds To Seconds - conTime2Sec(days, years, hours, min, sec) = Returns: uint32_t
 uint32_t DateTimeFunctions::conTime2Sec(const uint32_t _DAYS, const uint16_t _YEARS, const uint32_t _HOURS, const uint32_t _MIN, const uint8_t _SEC) {
+  STAT(conTime2Sec);
   // Convert Days, Years, Hours, Minutes And Seconds To Seconds.
   // Max Value  = 136.years, 70.days, 6.hours, 28.min, 15.sec
   return (_YEARS * 31536000UL) + (_DAYS * 86400UL) + (_HOURS * 3600UL) + (_MIN * 60UL) + _SEC;
@@ -1160,21 +1646,14 @@ uint32_t DateTimeFunctions::conTime2Sec(const uint32_t _DAYS, const uint16_t _YE
 
 // Convert Number To Roman Numerals - conNum2Roman(0-10000) = Returns: N-MMMMMMMMMM
 char* DateTimeFunctions::conNum2Roman(const uint16_t _IN) {
+  STAT(conNum2Roman);
   // Convert Number To Roman Numerals. 0 to 10000
   // https://en.wikipedia.org/wiki/Roman_numerals
   // The highest number that can be expressed in Roman numerals is actually 3999.
   // 3999 is written as MMMCMXCIX. This is because the number 4000 would have to be written as MMMM,
   // which goes against the principle of not having four consecutive letters of the same type together.
-  #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                 // Use Flash
-    const static char _ROMANS[13][3] PROGMEM = {"M", "CM", "D", "CD", "C", "XC", "L", "XL", "X", "IX", "V", "IV", "I"};
-  #else                                                                 // Use SRAM
-    const static char _ROMANS[13][3] = {"M", "CM", "D", "CD", "C", "XC", "L", "XL", "X", "IX", "V", "IV", "I"};
-  #endif
-  const uint16_t _ROMANVALUES[13] = {1000U, 900U, 500U, 400U, 100U, 90U, 50U, 40U, 10U, 9U, 5U, 4U, 1U};
-
   // Max String = (8888) = MMMMMMMMDCCCLXXXVIII = 20.characters.
   char* _buffer = __dateTimeStaticBuffer;                               // String Buffer
-  int32_t _in = _IN;                                                    // Set The Value To int32_t
 
   // Lets Just Stop At 10000. Else The buffer Needs To Be Bigger Than 21
   if (_IN > 10000U) {                                                   // In Value Is To Big
@@ -1186,113 +1665,953 @@ char* DateTimeFunctions::conNum2Roman(const uint16_t _IN) {
     return _buffer;                                                     // Return The String
   }
 
+  // Make The String
+  _buffer[N2R(_buffer, _IN)] = '\0';                                    // Null Terminate The String
+  return _buffer;                                                       // Return The String
+}
+
+// Make The Roman Numerals - Private - Returns: String Length (Not Null Terminated)
+uint8_t DateTimeFunctions::N2R(char* _buffer, const uint16_t _IN) {
+  // Make The Roman Numerals - One Table Pattern Per Decimal Digit
+  // Every digit 0-9 is the same pattern of "one", "five" and "ten" symbols in each decimal place:
+  // 4 = one five (IV, XL, CD) & 9 = one ten (IX, XC, CM). ROMAN_P holds up to 4.roles per digit,
+  // 2.bits each (1 = one, 2 = five, 3 = ten, 0 = end). The place picks the symbols from ROMAN_S.
+  uint8_t _index = 0;                                                   // Buffer Index
+
   // 0 Is Written As "N" or "NULLA"
   if (_IN == 0U) {                                                      // 0 is written N or NULLA
-    _buffer[0] = 'N';                                                   // Add The N
-    _buffer[1] = '\0';                                                  // Null Terminate The String
-    return _buffer;                                                     // Return The String
+    _buffer[_index++] = 'N';                                            // Add The N
+    return _index;                                                      // Return The Length
   }
 
-  // Make The String
-  uint8_t _index = 0;                                                   // Buffer Index
-  uint8_t _i = 0;                                                       // Array Index
-  for (uint8_t i = 0; i < 13; ++i) {                                    // Loop Thro The Romans Letters
-    while (_in - _ROMANVALUES[i] >= 0) {                                // While The Cal Value Is 0 Or Bigger
-      _in -= _ROMANVALUES[i];                                           // Calculate The Values
-      while (true) {                                                    // Add To The String
-        #if DATETIMEFUNCTIONS_MEMORY_USE == 0                           // Use Flash
-          _buffer[_index++] = (char)pgm_read_word(&(_ROMANS[i][_i++])); // Add This
-          if (_i >= strlen_P(_ROMANS[i]) - 1) {                         // Reset & Break
-            _i = 0;                                                     // Reset Array Index
-            break;                                                      // Stop The String While Function
-          }
-        #else                                                           // Use SRAM
-          _buffer[_index++] = _ROMANS[i][_i++];                         // Add This
-          if (_i >= strlen(_ROMANS[i]) - 1) {                           // Reset & Break
-            _i = 0;                                                     // Reset Array Index
-            break;                                                      // Stop The String While Function
-          }
-        #endif
-      }
+  // Thousands - Only M's
+  uint16_t _in = _IN;                                                   // Value Left
+  const uint8_t _THOUSANDS = _in / 1000U;                               // Thousands Digit (0-10)
+  _in -= _THOUSANDS * 1000U;                                            // Remove The Thousands
+  for (uint8_t _i = 0; _i < _THOUSANDS; _i++) _buffer[_index++] = 'M';  // Add The M's
+
+  // Hundreds, Tens & Units
+  const uint8_t _DIGITS[3] = {(uint8_t)(_in / 100U), (uint8_t)((_in / 10U) % 10U), (uint8_t)(_in % 10U)};
+  #if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST        // Fast - Copy The Ready Made Digit
+  for (uint8_t _place = 0; _place < 3; _place++) {                      // Hundreds = 0, Tens = 1, Units = 2
+    for (uint8_t _c = 0; _c < 4; _c++) {                                // Max 4.Symbols Per Digit
+      #if DATETIMEFUNCTIONS_MEMORY_USE == 0                             // Use Flash
+        const char _SYMBOL = (char)PM(&(ROMAN_F[_place * 10U + _DIGITS[_place]][_c])); // Get The Symbol
+      #else                                                             // Use SRAM
+        const char _SYMBOL = ROMAN_F[_place * 10U + _DIGITS[_place]][_c];          // Get The Symbol
+      #endif
+      if (_SYMBOL == '\0') break;                                       // End Of The Digit
+      _buffer[_index++] = _SYMBOL;                                      // Add The Symbol
     }
   }
-  _buffer[_index] = '\0';                                               // Null Terminate The String
-  return _buffer;                                                       // Return The String
+  #else                                                                 // Small - Build The Digit From ROMAN_P
+  for (uint8_t _place = 0; _place < 3; _place++) {                      // Hundreds = 0, Tens = 1, Units = 2
+    const uint8_t _ONE = (2 - _place) * 2;                              // "One" Symbol Index In ROMAN_S
+    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
+      uint8_t _pattern = PM(ROMAN_P + _DIGITS[_place]);                 // Get The Digit Pattern
+      for (; _pattern != 0; _pattern >>= 2)                             // Add The Symbols
+        _buffer[_index++] = (char)PM(ROMAN_S + _ONE + (_pattern & 3) - 1);
+    #else                                                               // Use SRAM
+      uint8_t _pattern = ROMAN_P[_DIGITS[_place]];                      // Get The Digit Pattern
+      for (; _pattern != 0; _pattern >>= 2)                             // Add The Symbols
+        _buffer[_index++] = ROMAN_S[_ONE + (_pattern & 3) - 1];
+    #endif
+  }
+  #endif
+  return _index;                                                        // Return The Length
+}
+
+// Convert Roman Numerals To Number - conRoman2Num("N"-"MMMMMMMMMM") = Returns: 0-10000 Or 65535 On Error
+uint16_t DateTimeFunctions::conRoman2Num(const char* _IN) {
+  STAT(conRoman2Num);
+  // Convert Roman Numerals To Number - Single Pass With Validation
+  // Only the standard form is accepted, the same as conNum2Roman() makes: "IIII", "VV", "IC" or "XM" is an error.
+  // Each decimal place is read once: one ten = 9, one five = 4, one's = 1-3, five + one's = 5-8.
+  if (_IN == NULL) return 65535U;                                       // Error
+  if (_IN[0] == 'N' && _IN[1] == '\0') return 0U;                       // 0 Is Written As "N"
+  uint8_t _i = 0;                                                       // String Index
+  uint16_t _num = 0U;                                                   // Number
+
+  // Thousands - Up To 10 M's
+  while (_IN[_i] == 'M') {                                              // Count The M's
+    if (++_i > 10) return 65535U;                                       // Error - To Big
+    _num += 1000U;                                                      // Add 1000
+  }
+
+  // Hundreds, Tens & Units
+  uint16_t _multi = 100U;                                               // Place Value
+  for (uint8_t _place = 0; _place < 3; _place++, _multi /= 10U) {       // Hundreds = 0, Tens = 1, Units = 2
+    const uint8_t _ONE = (2 - _place) * 2;                              // "One" Symbol Index In ROMAN_S
+    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
+      const char _SONE = (char)PM(ROMAN_S + _ONE);                      // One Symbol
+      const char _SFIVE = (char)PM(ROMAN_S + _ONE + 1);                 // Five Symbol
+      const char _STEN = (char)PM(ROMAN_S + _ONE + 2);                  // Ten Symbol
+    #else                                                               // Use SRAM
+      const char _SONE = ROMAN_S[_ONE];                                 // One Symbol
+      const char _SFIVE = ROMAN_S[_ONE + 1];                            // Five Symbol
+      const char _STEN = ROMAN_S[_ONE + 2];                             // Ten Symbol
+    #endif
+    uint8_t _digit = 0;                                                 // Digit In This Place
+    if (_IN[_i] == _SONE) {                                             // Starts With One
+      if (_IN[_i + 1] == _STEN) { _digit = 9; _i += 2; }                // 9 = IX, XC, CM
+      else if (_IN[_i + 1] == _SFIVE) { _digit = 4; _i += 2; }          // 4 = IV, XL, CD
+      else while (_digit < 3 && _IN[_i] == _SONE) { _digit++; _i++; }   // 1-3 = I, II, III
+    }
+    else if (_IN[_i] == _SFIVE) {                                       // Starts With Five
+      _digit = 5; _i++;                                                 // 5 = V, L, D
+      while (_digit < 8 && _IN[_i] == _SONE) { _digit++; _i++; }        // 6-8 = VI, VII, VIII
+    }
+    _num += _digit * _multi;                                            // Add The Digit
+  }
+
+  // Anything Left Is Not In The Standard Form
+  if (_i == 0 || _IN[_i] != '\0' || _num > 10000U) return 65535U;       // Error
+  return _num;                                                          // Return The Number
 }
 
 // Convert Gregorian To Julian Calendar - conGre2Jul(day, month, year, false/true) = Returns: DD/MM/YYYY Or DD/Jan/YYYY
 char* DateTimeFunctions::conGre2Jul(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const bool _USEMONTHNAME) {
+  STAT(conGre2Jul);
   // Convert Gregorian To Julian Calendar - The Roman Calendar Version
   // https://en.wikipedia.org/wiki/Julian_calendar#
   // https://en.wikipedia.org/wiki/Conversion_between_Julian_and_Gregorian_calendars
-  // Formula To Calculate Day Difference: ((year / 100) - ((year / 100) / 4)) - 2
-  // Example: ((2023 / 100) - ((2023 / 100) / 4)) - 2 = 13 & ((2100 / 100) - ((2100 / 100) / 4)) - 2 = 14
-  // Take this formula with a grain of salt, as there is no public formula to make the convert.
-  // But like you can see in the "Formula Test" below, it is pretty accurate.
-  // List From Wikipedia.
-  //       Year: 200, 300, 500, 600, 700, 900, 1000, 1100, 1300, 1400, 1500, 1700, 1800, 1900, 2100
-  // Difference:   0,   1,   2,   3,   4,   5,    6,    7,    8,    9,    10,   11,  12,   13,   14
-  // Formula Test:
-  // 200-299=0 _ 300-499=1 _ 500-599=2 _ 600-699=3 _ 700-899=4 _ 900-999=5 _ 1000-1099=6
-  // 1100-1299=7 _ 1300-1399=8 _ 1400-1499=9 _ 1500-1699=10 _ 1700-1799=11 _ 1800-1899=12
-  // 1900-2099=13 _ 2100-2199=14 _ 2200-2299=15 _ 2300-2499=16 _ 2500-2599=17 _ 2600-2699=18
-
+  // Exact: Gregorian date -> Julian Day Number -> Julian calendar date.
+  // Example: 28/02/2023 = JDN 2460004 = 15/02/2023 Julian & 01/03/2100 = 16/02/2100 Julian.
   // Max String = DD/MMM/YYYY = 11.characters.
-
-  // Variables
   uint8_t  _day   = 0;                                              // Day Nr
   uint8_t  _month = 0;                                              // Month Nr
   uint16_t _year  = 0U;                                             // Year Nr
-  const uint8_t _DIFF = ((_YEAR / 100) - ((_YEAR / 100) / 4)) - 2;  // Calculate The Days Difference
+  conJDN2Jul(conGre2JDN(_DAY, _MONTH, _YEAR), _day, _month, _year); // Convert Thro The Julian Day Number
+
+  // Make The String
+  if (_USEMONTHNAME) return MTDTS(_day, _month, _year, 0, 0, 0, 3); // Use MTDTS() - Type 3
+  else return MTDTS(_day, _month, _year, 0, 0, 0, 2);               // Use MTDTS() - Type 2
+}
+
+// Convert Gregorian Date To Julian Day Number - conGre2JDN(day, month, year) = Returns: 1721060-25657591
+int32_t DateTimeFunctions::conGre2JDN(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(conGre2JDN);
+  // Convert Gregorian Date To Julian Day Number (Proleptic Gregorian Calendar)
+  // https://en.wikipedia.org/wiki/Julian_day
+  // The year is counted from March, so the leap day is the last day of the year and
+  // the month lengths follow (153 * month + 2) / 5. Shifting the year by 4800 keeps it all positive.
+  // 01/01/0000 = 1721060 & 01/01/1970 = 2440588 & 31/12/65535 = 25657591
+  const uint8_t _A  = (_MONTH <= 2) ? 1 : 0;                              // January & February Belong To Last Year
+  const uint32_t _Y = (uint32_t)_YEAR + 4800UL - _A;                      // Shifted Year
+  const uint32_t _M = (uint32_t)_MONTH + 12UL * _A - 3UL;                 // Month From March = 0
+  return _DAY + (153UL * _M + 2UL) / 5UL + 365UL * _Y + _Y / 4UL - _Y / 100UL + _Y / 400UL - 32045UL;
+}
+
+// Convert Gregorian Date To Julian Day Number - conGre2JDN(day, month, year, jdn) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conGre2JDN(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, int32_t& _jdn) {
+  STAT(conGre2JDNChecked);
+  if (!VDT(_DAY, _MONTH, _YEAR)) return false;                // Wrong Date
+  _jdn = conGre2JDN(_DAY, _MONTH, _YEAR);                     // Set The Julian Day Number
+  return true;                                                // Valid
+}
+
+// Convert Julian Calendar Date To Julian Day Number - conJul2JDN(day, month, year) = Returns: 1721058-25658081
+int32_t DateTimeFunctions::conJul2JDN(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  STAT(conJul2JDN);
+  // Convert Julian Calendar Date To Julian Day Number
+  // The same as conGre2JDN() but every 4.th year is a leap year.
+  const uint8_t _A  = (_MONTH <= 2) ? 1 : 0;                              // January & February Belong To Last Year
+  const uint32_t _Y = (uint32_t)_YEAR + 4800UL - _A;                      // Shifted Year
+  const uint32_t _M = (uint32_t)_MONTH + 12UL * _A - 3UL;                 // Month From March = 0
+  return _DAY + (153UL * _M + 2UL) / 5UL + 365UL * _Y + _Y / 4UL - 32083UL;
+}
+
+// Convert Julian Day Number To Gregorian Date - conJDN2Gre(JDN, day, month, year) = Sets: day, month & year
+void DateTimeFunctions::conJDN2Gre(const int32_t _JDN, uint8_t& _day, uint8_t& _month, uint16_t& _year) {
+  STAT(conJDN2Gre);
+  // Convert Julian Day Number To Gregorian Date (Proleptic Gregorian Calendar)
+  // https://en.wikipedia.org/wiki/Julian_day#Julian_or_Gregorian_calendar_from_Julian_day_number
+  // Split into 400.year eras (146097.days), then 4.year cycles (1461.days), then March based months.
+  // _JDN needs to be 1721060 (01/01/0000) or more.
+  const uint32_t _A = (uint32_t)_JDN + 32044UL;                           // Days Since 01/03/-4800
+  const uint32_t _B = (4UL * _A + 3UL) / 146097UL;                        // 400.Year Eras
+  const uint32_t _C = _A - (146097UL * _B) / 4UL;                         // Days In The Era
+  const uint32_t _D = (4UL * _C + 3UL) / 1461UL;                          // Years In The Era
+  const uint32_t _E = _C - (1461UL * _D) / 4UL;                           // Day Of The March Based Year
+  const uint32_t _M = (5UL * _E + 2UL) / 153UL;                           // Month From March = 0
+  _day   = _E - (153UL * _M + 2UL) / 5UL + 1UL;                           // Set The Day
+  _month = _M + 3UL - 12UL * (_M / 10UL);                                 // Set The Month
+  _year  = 100UL * _B + _D - 4800UL + _M / 10UL;                          // Set The Year
+}
+
+// Convert Julian Day Number To Julian Calendar Date - conJDN2Jul(JDN, day, month, year) = Sets: day, month & year
+void DateTimeFunctions::conJDN2Jul(const int32_t _JDN, uint8_t& _day, uint8_t& _month, uint16_t& _year) {
+  STAT(conJDN2Jul);
+  // Convert Julian Day Number To Julian Calendar Date
+  // The same as conJDN2Gre() without the 400.year eras.
+  // _JDN needs to be 1721058 (01/01/0000 Julian) or more.
+  const uint32_t _C = (uint32_t)_JDN + 32082UL;                           // Days Since 01/03/-4800
+  const uint32_t _D = (4UL * _C + 3UL) / 1461UL;                          // Years
+  const uint32_t _E = _C - (1461UL * _D) / 4UL;                           // Day Of The March Based Year
+  const uint32_t _M = (5UL * _E + 2UL) / 153UL;                           // Month From March = 0
+  _day   = _E - (153UL * _M + 2UL) / 5UL + 1UL;                           // Set The Day
+  _month = _M + 3UL - 12UL * (_M / 10UL);                                 // Set The Month
+  _year  = _D - 4800UL + _M / 10UL;                                       // Set The Year
+}
+
+// Convert Julian Day Number To Modified Julian Day - conJDN2MJD(JDN) = Returns: MJD
+int32_t DateTimeFunctions::conJDN2MJD(const int32_t _JDN) {
+  STAT(conJDN2MJD);
+  // Modified Julian Day - Starts At 17/11/1858 (JDN 2400001)
+  return _JDN - 2400001L;
+}
+
+// Convert Modified Julian Day To Julian Day Number - conMJD2JDN(MJD) = Returns: JDN
+int32_t DateTimeFunctions::conMJD2JDN(const int32_t _MJD) {
+  STAT(conMJD2JDN);
+  // Julian Day Number From Modified Julian Day
+  return _MJD + 2400001L;
+}
+
+// Convert Julian Day Number To Rata Die - conJDN2RD(JDN) = Returns: RD
+int32_t DateTimeFunctions::conJDN2RD(const int32_t _JDN) {
+  STAT(conJDN2RD);
+  // Rata Die - Day 1 Is 01/01/0001 Gregorian (JDN 1721426)
+  return _JDN - 1721425L;
+}
+
+// Convert Rata Die To Julian Day Number - conRD2JDN(RD) = Returns: JDN
+int32_t DateTimeFunctions::conRD2JDN(const int32_t _RD) {
+  STAT(conRD2JDN);
+  // Julian Day Number From Rata Die
+  return _RD + 1721425L;
+}
+
+
+//--------------------- Epoch ---------------------//
+
+// Epoch Offsets - Days From The Epoch To 01/01/1970, From conGre2JDN(): JDN(01/01/1970) = 2440588
+// NTP      01/01/1900 = JDN 2415021 =  25567.days =   2208988800.sec
+// GPS      06/01/1980 = JDN 2444245 =  -3657.days =   -315964800.sec
+// FILETIME 01/01/1601 = JDN 2305814 = 134774.days =  11644473600.sec
+// Ticks    01/01/0001 = JDN 1721426 = 719162.days =  62135596800.sec
+// Excel    Serial 25569 = 01/01/1970. Excel thinks 1900 was a leap year, so serial 1-59 are one day off.
 
-  // Year
-  if (_DAY <= _DIFF && _MONTH == 1) _year = _YEAR - 1U;             // Set The Year
-  else _year = _YEAR;                                               // Set The Year
-  // Day And Month
-  if (_DAY > _DIFF && _MONTH >= 1) {                                // We Are In Same Year & More Than _DIFF Days
-    _day = _DAY - _DIFF;                                            // Calculate The Day
-    _month = _MONTH;                                                // Set The Month
+// Convert NTP Seconds To Unix Time - conNTP2UT(NTPseconds) = Returns: Unix Time "-61505152 ... 4233462143"
+int64_t DateTimeFunctions::conNTP2UT(const uint32_t _NTPSEC) {
+  STAT(conNTP2UT);
+  // Convert NTP Seconds To Unix Time - RFC 4330
+  // NTP seconds wrap on 07/02/2036. With the high bit set it is era 0 (1968-2036), else era 1 (2036-2104).
+  if (_NTPSEC & 0x80000000UL) return (int64_t)_NTPSEC - 2208988800LL;      // Era 0
+  return (int64_t)_NTPSEC + 4294967296LL - 2208988800LL;                     // Era 1
+}
+
+// Convert Unix Time To NTP Seconds - conUT2NTP(unixTime) = Returns: NTP Seconds (Era Wraps)
+uint32_t DateTimeFunctions::conUT2NTP(const int64_t _UNIXTIME) {
+  STAT(conUT2NTP);
+  // Convert Unix Time To NTP Seconds
+  return (uint32_t)(_UNIXTIME + 2208988800LL);                               // Wraps On 07/02/2036
+}
+
+// Convert NTP Fraction To Microseconds - conNTPFrac2Micros(fraction) = Returns: 0-999999
+uint32_t DateTimeFunctions::conNTPFrac2Micros(const uint32_t _FRAC) {
+  STAT(conNTPFrac2Micros);
+  // NTP Fraction Is 1/2^32 Of A Second
+  return ((uint64_t)_FRAC * 1000000ULL) >> 32;                               // Return The Microseconds
+}
+
+// Convert Microseconds To NTP Fraction - conMicros2NTPFrac(micros) = Returns: NTP Fraction
+uint32_t DateTimeFunctions::conMicros2NTPFrac(const uint32_t _MICROS) {
+  STAT(conMicros2NTPFrac);
+  // Round Up, So conNTPFrac2Micros() Gives The Same Microseconds Back
+  return (((uint64_t)_MICROS << 32) + 999999ULL) / 1000000ULL;               // Return The Fraction
+}
+
+// Convert GPS Week & Seconds Of Week To Unix Time - conGPS2UT(week, TOW, leapSeconds) = Returns: Unix Time
+int64_t DateTimeFunctions::conGPS2UT(const uint16_t _WEEK, const uint32_t _TOW, const uint8_t _LEAPSEC) {
+  STAT(conGPS2UT);
+  // Convert GPS Time To Unix Time
+  // GPS time does not have leap seconds, it is _LEAPSEC (18 since 2017) ahead of UTC.
+  // _WEEK is the full week number. Receivers with a 10.bit week need the 1024 rollovers added.
+  return 315964800LL + (int64_t)_WEEK * 604800LL + _TOW - _LEAPSEC;        // Return The Unix Time
+}
+
+// Convert Unix Time To GPS Week & Seconds Of Week - conUT2GPS(unixTime, week, TOW, leapSeconds) = Returns: false If Clamped "0-1"
+bool DateTimeFunctions::conUT2GPS(const int64_t _UNIXTIME, uint16_t& _week, uint32_t& _tow, const uint8_t _LEAPSEC) {
+  STAT(conUT2GPS);
+  // Convert Unix Time To GPS Time
+  // Before 06/01/1980 it is clamped to week 0 & TOW 0, past week 65535 to its last second.
+  const int64_t _GPS = _UNIXTIME - 315964800LL + _LEAPSEC;                   // GPS Seconds
+  if (_GPS < 0LL) { _week = 0; _tow = 0UL; return false; }                  // Before The GPS Epoch
+  if (_GPS >= 65536LL * 604800LL) { _week = 65535U; _tow = 604799UL; return false; } // Past The Last Week
+  _week = (uint16_t)(_GPS / 604800LL);                                       // Set The Week
+  _tow  = (uint32_t)(_GPS - (int64_t)_week * 604800LL);                      // Set The Seconds Of Week
+  return true;                                                               // In Range
+}
+
+// Convert Excel Serial Day To Unix Time - conExcel2UT(serial, secondsFromMidnight) = Returns: Unix Time
+int64_t DateTimeFunctions::conExcel2UT(const uint32_t _SERIAL, const uint32_t _SFM) {
+  STAT(conExcel2UT);
+  // Convert Excel Serial Day To Unix Time - 1900 Date System
+  // Serial 60 is the 29/02/1900 that never was, it is read as 01/03/1900.
+  const uint32_t _SERIALFIX = (_SERIAL == 60UL) ? 61UL : _SERIAL;           // 29/02/1900 = 01/03/1900
+  const int64_t _DAYS = (_SERIALFIX >= 61UL) ? (int64_t)_SERIALFIX - 25569LL : (int64_t)_SERIALFIX - 25568LL;
+  return _DAYS * 86400LL + _SFM;                                             // Return The Unix Time
+}
+
+// Convert Unix Time To Excel Serial Day - conUT2Excel(unixTime) = Returns: Excel Serial Day "1 = 01/01/1900", 0 = Before
+uint32_t DateTimeFunctions::conUT2Excel(const int64_t _UNIXTIME) {
+  STAT(conUT2Excel);
+  // Convert Unix Time To Excel Serial Day - 1900 Date System
+  // Use getSFM() or _UNIXTIME % 86400 for the time of day.
+  // Before 01/01/1900 it is clamped to 0 (Excel day 0), past the 32.bit serial to 0xFFFFFFFF.
+  const int64_t _SERIAL = FDIV(_UNIXTIME, 86400LL) + 25569LL;                // Serial From 01/03/1900
+  if (_SERIAL < 1LL) return 0UL;                                             // Before 01/01/1900
+  if (_SERIAL > 0xFFFFFFFFLL) return 0xFFFFFFFFUL;                           // Past The Last Serial
+  return (_SERIAL >= 61LL) ? _SERIAL : _SERIAL - 1LL;                        // Return The Serial Day
+}
+
+// Convert Windows FILETIME To Unix Time - conFT2UT(FILETIME) = Returns: Unix Time
+int64_t DateTimeFunctions::conFT2UT(const uint64_t _FILETIME) {
+  STAT(conFT2UT);
+  // FILETIME = 100.ns Since 01/01/1601
+  return (int64_t)(_FILETIME / 10000000ULL) - 11644473600LL;                 // Return The Unix Time
+}
+
+// Convert Unix Time To Windows FILETIME - conUT2FT(unixTime) = Returns: FILETIME
+uint64_t DateTimeFunctions::conUT2FT(const int64_t _UNIXTIME) {
+  STAT(conUT2FT);
+  // FILETIME = 100.ns Since 01/01/1601
+  return (uint64_t)(_UNIXTIME + 11644473600LL) * 10000000ULL;                // Return The FILETIME
+}
+
+// Convert .NET Ticks To Unix Time - conTicks2UT(ticks) = Returns: Unix Time
+int64_t DateTimeFunctions::conTicks2UT(const uint64_t _TICKS) {
+  STAT(conTicks2UT);
+  // .NET Ticks = 100.ns Since 01/01/0001
+  return (int64_t)(_TICKS / 10000000ULL) - 62135596800LL;                    // Return The Unix Time
+}
+
+// Convert Unix Time To .NET Ticks - conUT2Ticks(unixTime) = Returns: Ticks
+uint64_t DateTimeFunctions::conUT2Ticks(const int64_t _UNIXTIME) {
+  STAT(conUT2Ticks);
+  // .NET Ticks = 100.ns Since 01/01/0001
+  return (uint64_t)(_UNIXTIME + 62135596800LL) * 10000000ULL;                // Return The Ticks
+}
+
+// Convert Array From Epoch To Unix Time - conEpoch2UT(epoch, in, out, count)
+void DateTimeFunctions::conEpoch2UT(const uint8_t _EPOCH, const uint64_t* _IN, int64_t* _OUT, const uint16_t _COUNT) {
+  STAT(conEpoch2UT);
+  // Convert Many Values - The Epoch Is Picked Once, Not Per Value
+  // NTP = NTP seconds & GPS = GPS seconds (week * 604800 + TOW, 18 leap seconds removed as conGPS2UT()) & Excel = serial day.
+  // GPS seconds are not split into a 16.bit week, so weeks past 65535 are kept.
+  uint16_t _i = 0;                                                           // Array Index
+  switch (_EPOCH) {
+    case DATETIMEFUNCTIONS_EPOCH_NTP:      for (; _i < _COUNT; _i++) _OUT[_i] = conNTP2UT((uint32_t)_IN[_i]); break;
+    case DATETIMEFUNCTIONS_EPOCH_GPS:      for (; _i < _COUNT; _i++) _OUT[_i] = (int64_t)(_IN[_i] + (315964800ULL - 18ULL)); break;
+    case DATETIMEFUNCTIONS_EPOCH_EXCEL:    for (; _i < _COUNT; _i++) _OUT[_i] = conExcel2UT((uint32_t)_IN[_i]); break;
+    case DATETIMEFUNCTIONS_EPOCH_FILETIME: for (; _i < _COUNT; _i++) _OUT[_i] = conFT2UT(_IN[_i]); break;
+    case DATETIMEFUNCTIONS_EPOCH_TICKS:    for (; _i < _COUNT; _i++) _OUT[_i] = conTicks2UT(_IN[_i]); break;
+    default:                               for (; _i < _COUNT; _i++) _OUT[_i] = (int64_t)_IN[_i]; break; // Unix Time
   }
-  else if (_DAY <= _DIFF && _MONTH > 1) {                           // We Are In Same Year & Less Than _DIFF Days
-    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                           // Use Flash
-      _day = (PM(DIM_N + (_MONTH - 2)) - _DIFF) + _DAY;             // Calculate The Day
-    #else                                                           // Use SRAM
-      _day = (DIM_N[_MONTH - 2] - _DIFF) + _DAY;                    // Calculate The Day
-    #endif
-    _month = _MONTH - 1;                                            // Set The Month
+}
+
+// Convert Array From Unix Time To Epoch - conUT2Epoch(epoch, in, out, count)
+void DateTimeFunctions::conUT2Epoch(const uint8_t _EPOCH, const int64_t* _IN, uint64_t* _OUT, const uint16_t _COUNT) {
+  STAT(conUT2Epoch);
+  // Convert Many Values - The Epoch Is Picked Once, Not Per Value
+  // GPS & Excel are clamped to 0 before their epoch as conUT2GPS() & conUT2Excel(). GPS has no 16.bit week, so no last week.
+  const int64_t _GPSEPOCH = 315964800LL - 18LL;                             // Unix Time Of GPS Second 0
+  uint16_t _i = 0;                                                           // Array Index
+  switch (_EPOCH) {
+    case DATETIMEFUNCTIONS_EPOCH_NTP:      for (; _i < _COUNT; _i++) _OUT[_i] = conUT2NTP(_IN[_i]); break;
+    case DATETIMEFUNCTIONS_EPOCH_GPS:      for (; _i < _COUNT; _i++) _OUT[_i] = (_IN[_i] < _GPSEPOCH) ? 0ULL : (uint64_t)(_IN[_i] - _GPSEPOCH); break;
+    case DATETIMEFUNCTIONS_EPOCH_EXCEL:    for (; _i < _COUNT; _i++) _OUT[_i] = conUT2Excel(_IN[_i]); break;
+    case DATETIMEFUNCTIONS_EPOCH_FILETIME: for (; _i < _COUNT; _i++) _OUT[_i] = conUT2FT(_IN[_i]); break;
+    case DATETIMEFUNCTIONS_EPOCH_TICKS:    for (; _i < _COUNT; _i++) _OUT[_i] = conUT2Ticks(_IN[_i]); break;
+    default:                               for (; _i < _COUNT; _i++) _OUT[_i] = (uint64_t)_IN[_i]; break; // Unix Time
   }
-  else {                                                            // We Are Still In December
-    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                           // Use Flash
-      _day = (PM(DIM_N + 11) - _DIFF) + _DAY;                       // Calculate The Day
-    #else                                                           // Use SRAM
-      _day = (DIM_N[11] - _DIFF) + _DAY;                            // Calculate The Day
-    #endif
-    _month = 12;                                                    // Set The Month
+}
+
+// Floor Division - Private - Returns: _A / _B Rounded Down (Also For Negative _A)
+int64_t DateTimeFunctions::FDIV(const int64_t _A, const int64_t _B) {
+  const int64_t _Q = _A / _B;                                                // Rounds To Zero
+  return (_Q * _B > _A) ? _Q - 1 : _Q;                                       // Round Down
+}
+
+
+
+
+//---------------------- RTC ----------------------//
+
+// The registers are the 7.bytes from the seconds register, as read in one go from the chip
+// (DS1307 & DS3231 from 0x00, PCF8563 from 0x02). Each byte is two BCD digits: 0x59 = 59.
+// BCD to binary is _B - 6 * (_B >> 4) & binary to BCD is _V + 6 * (_V / 10), no tables.
+// A digit above 9 is found by adding 6: it then carries into bit 4, so all digits of the
+// block are checked with one OR & one test at the end.
+// Seconds bit 7 (DS1307 clock halt, PCF8563 low voltage) is not part of the time & is left out.
+// It is written as 0, which starts the DS1307 clock. The century bit adds 100 to the year.
+
+// Convert RTC Registers To Date Time Fields - conBCD2DT(regs, fields, DATETIMEFUNCTIONS_RTC_DS3231) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conBCD2DT(const uint8_t* _REGS, DateTimeFields& _fields, const uint8_t _CHIP) {
+  STAT(conBCD2DT);
+  return B2F(_REGS, _fields, _CHIP);                                         // Use B2F()
+}
+
+// Convert RTC Registers To Unix Time - conBCD2UT(regs, unixTime, DATETIMEFUNCTIONS_RTC_DS3231) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conBCD2UT(const uint8_t* _REGS, uint64_t& _unixTime, const uint8_t _CHIP) {
+  STAT(conBCD2UT);
+  DateTimeFields _f;                                                         // Date Time Fields
+  if (!B2F(_REGS, _f, _CHIP)) return false;                                  // Not Valid
+  const uint32_t _DAYS = DFC(_f.year, _f.month) + _f.day - 1UL - 719468UL;   // Days Since 01/01/1970 - Year 2000 And Up
+  _unixTime = (uint64_t)_DAYS * 86400ULL + (_f.hour * 3600UL + _f.minute * 60U + _f.second); // Set The Unix Time
+  return true;                                                               // Valid
+}
+
+// Convert Date Time Fields To RTC Registers - conDT2BCD(fields, regs, DATETIMEFUNCTIONS_RTC_DS3231, false/true) = Returns: true If Valid "0-1"
+bool DateTimeFunctions::conDT2BCD(const DateTimeFields& _FIELDS, uint8_t* _regs, const uint8_t _CHIP, const bool _USE12) {
+  STAT(conDT2BCD);
+  return F2B(_FIELDS.day, _FIELDS.month, _FIELDS.year, _FIELDS.hour, _FIELDS.minute, _FIELDS.second, _regs, _CHIP, _USE12); // Use F2B()
+}
+
+// Convert Unix Time To RTC Registers - conUT2BCD(unixTime, regs, DATETIMEFUNCTIONS_RTC_DS3231, false/true) = Returns: true If The Chip Can Hold The Year "0-1"
+bool DateTimeFunctions::conUT2BCD(const uint64_t _UNIXTIME, uint8_t* _regs, const uint8_t _CHIP, const bool _USE12) {
+  STAT(conUT2BCD);
+  uint8_t _day, _month, _hour, _min, _sec;                                   // Date Time Fields
+  uint16_t _year;                                                            // Year
+  UT2F(_UNIXTIME, _day, _month, _year, _hour, _min, _sec);                   // Split The Unix Time
+  return F2B(_day, _month, _year, _hour, _min, _sec, _regs, _CHIP, _USE12);  // Use F2B()
+}
+
+// BCD Registers To Date Time Fields - Private - Returns: true If Valid "0-1"
+bool DateTimeFunctions::B2F(const uint8_t* _REGS, DateTimeFields& _fields, const uint8_t _CHIP) {
+  const uint8_t _PCF = (_CHIP == DATETIMEFUNCTIONS_RTC_PCF8563);            // Day Before Day Of Week
+  const uint8_t _SEC = _REGS[0] & 0x7FU;                                     // Clock Halt / Low Voltage Left Out
+  const uint8_t _MIN = _REGS[1] & 0x7FU;                                     // Minutes
+  const uint8_t _HOUR = _REGS[2];                                            // Hours - Bit 6 = 12.Hour & Bit 5 = PM
+  const uint8_t _DAY = _REGS[_PCF ? 3 : 4] & 0x3FU;                         // Day
+  const uint8_t _MONTH = _REGS[5] & 0x1FU;                                   // Month
+  const uint8_t _YEAR = _REGS[6];                                            // Year 00-99
+  const uint8_t _H = (_HOUR & 0x40U) && !_PCF ? (_HOUR & 0x1FU) : (_HOUR & 0x3FU); // Hour Digits
+  // Digit Check - Adding 6 To A Digit Above 9 Sets Bit 4
+  const uint8_t _BAD = ((_SEC & 0x0FU) + 6U) | ((_SEC >> 4) + 6U) | ((_MIN & 0x0FU) + 6U) | ((_MIN >> 4) + 6U)
+                     | ((_H & 0x0FU) + 6U) | ((_DAY & 0x0FU) + 6U) | ((_MONTH & 0x0FU) + 6U)
+                     | ((_YEAR & 0x0FU) + 6U) | ((_YEAR >> 4) + 6U);
+  if (_BAD & 0x10U) return false;                                            // Not BCD
+  uint8_t _hour = _H - 6U * (_H >> 4);                                       // Hour
+  if ((_HOUR & 0x40U) && !_PCF) {                                            // 12.Hour
+    if (_hour == 0U || _hour > 12U) return false;                            // Not 1-12
+    _hour = (_hour == 12U ? 0U : _hour) + ((_HOUR & 0x20U) ? 12U : 0U);      // To 24.Hour
   }
+  _fields.second = _SEC - 6U * (_SEC >> 4);                                  // Second
+  _fields.minute = _MIN - 6U * (_MIN >> 4);                                  // Minute
+  _fields.hour = _hour;                                                      // Hour
+  _fields.day = _DAY - 6U * (_DAY >> 4);                                     // Day
+  _fields.month = _MONTH - 6U * (_MONTH >> 4);                               // Month
+  _fields.year = 2000U + (_YEAR - 6U * (_YEAR >> 4)) + ((_CHIP != DATETIMEFUNCTIONS_RTC_DS1307 && (_REGS[5] & 0x80U)) ? 100U : 0U); // Year & Century
+  return VDT(_fields.day, _fields.month, _fields.year) & VTM(_fields.hour, _fields.minute, _fields.second) & (_fields.second < 60U); // Valid Date & Time
+}
 
-  // Make The String
-  if (_USEMONTHNAME) return MTDTS(_day, _month, _year, 0, 0, 0, 3); // Use MTDTS() - Type 3
-  else return MTDTS(_day, _month, _year, 0, 0, 0, 2);               // Use MTDTS() - Type 2
+// Date Time Fields To BCD Registers - Private - Returns: true If The Chip Can Hold It "0-1"
+bool DateTimeFunctions::F2B(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, uint8_t* _regs, const uint8_t _CHIP, const bool _USE12) {
+  #define DATETIMEFUNCTIONS_BCD(_V) (uint8_t)((_V) + 6U * (((_V) * 205U) >> 11)) // _V / 10 For 0-99 Is (_V * 205) >> 11
+  const uint16_t _LAST = (_CHIP == DATETIMEFUNCTIONS_RTC_DS1307) ? 2099U : 2199U; // Last Year The Chip Can Hold
+  if (_YEAR < 2000U || _YEAR > _LAST || !VDT(_DAY, _MONTH, _YEAR) || !VTM(_HOUR, _MIN, _SEC) || _SEC > 59U) return false; // Not Valid
+  const uint8_t _PCF = (_CHIP == DATETIMEFUNCTIONS_RTC_PCF8563);            // Day Before Day Of Week
+  const uint8_t _Y = (_YEAR >= 2100U) ? _YEAR - 2100U : _YEAR - 2000U;      // Year 00-99
+  const uint8_t _DOW = (DFC(_YEAR, _MONTH) + _DAY + 2UL) % 7UL;              // Day Of Week - Sunday = 0, 01/03/0000 Was A Wednesday
+  _regs[0] = DATETIMEFUNCTIONS_BCD(_SEC);                                    // Seconds - Bit 7 = 0
+  _regs[1] = DATETIMEFUNCTIONS_BCD(_MIN);                                    // Minutes
+  if (_USE12 && !_PCF) {                                                     // 12.Hour - Bit 6 = 12.Hour & Bit 5 = PM
+    const uint8_t _H12 = (_HOUR % 12U == 0U) ? 12U : _HOUR % 12U;            // 1-12
+    _regs[2] = 0x40U | (_HOUR >= 12U ? 0x20U : 0U) | DATETIMEFUNCTIONS_BCD(_H12);
+  }
+  else _regs[2] = DATETIMEFUNCTIONS_BCD(_HOUR);                              // 24.Hour
+  _regs[_PCF ? 3 : 4] = DATETIMEFUNCTIONS_BCD(_DAY);                         // Day
+  _regs[_PCF ? 4 : 3] = _PCF ? _DOW : _DOW + 1U;                             // Day Of Week - PCF8563 0-6, DS 1-7 "Sunday = 1"
+  _regs[5] = DATETIMEFUNCTIONS_BCD(_MONTH) | ((_YEAR >= 2100U) ? 0x80U : 0U); // Month & Century
+  _regs[6] = DATETIMEFUNCTIONS_BCD(_Y);                                      // Year
+  return true;                                                               // Valid
+  #undef DATETIMEFUNCTIONS_BCD
+}
+
+
+
+
+//-------------------- Bucket ---------------------//
+
+// Floor, ceil & bucket work on local seconds since 01/03/0000 (unix time + 719468.days + _OFFSET),
+// so the day number is never negative & the year starts after the leap day. The day & the seconds
+// in the day come from one 32.bit division (86400 = 128 * 675). Minute, hour & day are multiply &
+// shift on the seconds in the day. Week, month, quarter & year use closed form day numbers - no loops.
+// _OFFSET is the time zone in seconds (+3600 = UTC+1), the periods start at local midnight.
+// A local start before 01/01/1970 is returned as 0.
+
+#define DATETIMEFUNCTIONS_BUCKET_BIAS (719468ULL * 86400ULL) // Seconds From 01/03/0000 To 01/01/1970
+
+// Floor To The Period - floorTo(unixTime, DATETIMEFUNCTIONS_PERIOD_..., offset) = Returns: Unix Time Of The Start Of The Period
+uint64_t DateTimeFunctions::floorTo(const uint64_t _UNIXTIME, const uint8_t _PERIOD, const int32_t _OFFSET) {
+  STAT(floorTo);
+  uint64_t _next; int64_t _index;                                       // Not Used
+  const uint64_t _FLOOR = PFL(_UNIXTIME + DATETIMEFUNCTIONS_BUCKET_BIAS + (int64_t)_OFFSET, _PERIOD, _next, _index); // Local Floor
+  const uint64_t _BASE = DATETIMEFUNCTIONS_BUCKET_BIAS + (int64_t)_OFFSET; // Local Seconds Of 01/01/1970 UTC
+  return (_FLOOR > _BASE) ? _FLOOR - _BASE : 0ULL;                      // Return The Floor
+}
+
+// Ceil To The Period - ceilTo(unixTime, DATETIMEFUNCTIONS_PERIOD_..., offset) = Returns: Unix Time, Or The Start Of The Next Period
+uint64_t DateTimeFunctions::ceilTo(const uint64_t _UNIXTIME, const uint8_t _PERIOD, const int32_t _OFFSET) {
+  STAT(ceilTo);
+  uint64_t _next; int64_t _index;                                       // Next Period
+  const uint64_t _LOCAL = _UNIXTIME + DATETIMEFUNCTIONS_BUCKET_BIAS + (int64_t)_OFFSET; // Local Seconds
+  if (PFL(_LOCAL, _PERIOD, _next, _index) == _LOCAL) return _UNIXTIME;  // On The Start Of A Period
+  return _next - (_LOCAL - _UNIXTIME);                                  // Return The Start Of The Next Period
+}
+
+// Periods From The Origin - bucketIndex(unixTime, DATETIMEFUNCTIONS_PERIOD_..., origin, offset) = Returns: Bucket, Negative Before The Origin
+int32_t DateTimeFunctions::bucketIndex(const uint64_t _UNIXTIME, const uint8_t _PERIOD, const uint64_t _ORIGIN, const int32_t _OFFSET) {
+  STAT(bucketIndex);
+  uint64_t _next; int64_t _index, _origin;                              // Period Numbers
+  PFL(_UNIXTIME + DATETIMEFUNCTIONS_BUCKET_BIAS + (int64_t)_OFFSET, _PERIOD, _next, _index); // Period Of The Time
+  PFL(_ORIGIN + DATETIMEFUNCTIONS_BUCKET_BIAS + (int64_t)_OFFSET, _PERIOD, _next, _origin); // Period Of The Origin
+  return (int32_t)(_index - _origin);                                   // Return The Bucket
+}
+
+// Floor Array To The Period - floorTo(DATETIMEFUNCTIONS_PERIOD_..., in, out, count, offset) - _OUT Can Be _IN
+void DateTimeFunctions::floorTo(const uint8_t _PERIOD, const uint64_t* _IN, uint64_t* _OUT, const uint16_t _COUNT, const int32_t _OFFSET) {
+  STAT(floorToBatch);
+  const uint64_t _BASE = DATETIMEFUNCTIONS_BUCKET_BIAS + (int64_t)_OFFSET; // Local Seconds Of 01/01/1970 UTC
+  uint64_t _next; int64_t _index;                                       // Not Used
+  for (uint16_t _i = 0; _i < _COUNT; _i++) {
+    const uint64_t _FLOOR = PFL(_IN[_i] + _BASE, _PERIOD, _next, _index); // Local Floor
+    _OUT[_i] = (_FLOOR > _BASE) ? _FLOOR - _BASE : 0ULL;                // Set The Floor
+  }
+}
+
+// Ceil Array To The Period - ceilTo(DATETIMEFUNCTIONS_PERIOD_..., in, out, count, offset) - _OUT Can Be _IN
+void DateTimeFunctions::ceilTo(const uint8_t _PERIOD, const uint64_t* _IN, uint64_t* _OUT, const uint16_t _COUNT, const int32_t _OFFSET) {
+  STAT(ceilToBatch);
+  const uint64_t _BASE = DATETIMEFUNCTIONS_BUCKET_BIAS + (int64_t)_OFFSET; // Local Seconds Of 01/01/1970 UTC
+  uint64_t _next; int64_t _index;                                       // Next Period
+  for (uint16_t _i = 0; _i < _COUNT; _i++) {
+    const uint64_t _LOCAL = _IN[_i] + _BASE;                            // Local Seconds
+    if (PFL(_LOCAL, _PERIOD, _next, _index) != _LOCAL) _OUT[_i] = _next - _BASE; // Set The Start Of The Next Period
+    else _OUT[_i] = _IN[_i];                                            // On The Start Of A Period
+  }
+}
+
+// Periods From The Origin For An Array - bucketIndex(DATETIMEFUNCTIONS_PERIOD_..., origin, in, out, count, offset)
+void DateTimeFunctions::bucketIndex(const uint8_t _PERIOD, const uint64_t _ORIGIN, const uint64_t* _IN, int32_t* _OUT, const uint16_t _COUNT, const int32_t _OFFSET) {
+  STAT(bucketIndexBatch);
+  const uint64_t _BASE = DATETIMEFUNCTIONS_BUCKET_BIAS + (int64_t)_OFFSET; // Local Seconds Of 01/01/1970 UTC
+  uint64_t _next; int64_t _index, _origin;                              // Period Numbers
+  PFL(_ORIGIN + _BASE, _PERIOD, _next, _origin);                        // Period Of The Origin - Once
+  for (uint16_t _i = 0; _i < _COUNT; _i++) {
+    PFL(_IN[_i] + _BASE, _PERIOD, _next, _index);                       // Period Of The Time
+    _OUT[_i] = (int32_t)(_index - _origin);                             // Set The Bucket
+  }
+}
+
+// Floor To A Period - Private - Local Seconds Since 01/03/0000 - Returns: The Floor, Sets: _next & _index (Period Number)
+uint64_t DateTimeFunctions::PFL(const uint64_t _LOCAL, const uint8_t _PERIOD, uint64_t& _next, int64_t& _index) {
+  // Days: 86400 = 128 * 675, So Below 2^39 Seconds (Year 17421) It Is One 32.bit Division
+  const uint32_t _Z = (_LOCAL < (1ULL << 39)) ? (uint32_t)(_LOCAL >> 7) / 675UL : (uint32_t)(_LOCAL / 86400ULL);
+  const uint32_t _SOD = (uint32_t)(_LOCAL - (uint64_t)_Z * 86400ULL);   // Seconds In The Day
+  const uint64_t _DAY = (uint64_t)_Z * 86400ULL;                        // Start Of The Day
+  switch (_PERIOD) {
+    case DATETIMEFUNCTIONS_PERIOD_MINUTE: {                             // Minute - Multiply & Shift
+      const uint8_t _HOUR = (uint8_t)((_SOD * 37283UL) >> 27);          // Hours   (/ 3600)
+      const uint16_t _MIN = _HOUR * 60U + (uint8_t)(((_SOD - _HOUR * 3600UL) * 2185UL) >> 17); // Minutes In The Day (/ 60)
+      _index = (int64_t)_Z * 1440LL + _MIN;                             // Minute Number
+      _next = _DAY + _MIN * 60UL + 60UL;                                // Next Minute
+      return _next - 60UL;                                              // Return The Floor
+    }
+    case DATETIMEFUNCTIONS_PERIOD_HOUR: {                               // Hour - Multiply & Shift
+      const uint8_t _HOUR = (uint8_t)((_SOD * 37283UL) >> 27);          // Hours   (/ 3600)
+      _index = (int64_t)_Z * 24LL + _HOUR;                              // Hour Number
+      _next = _DAY + _HOUR * 3600UL + 3600UL;                           // Next Hour
+      return _next - 3600UL;                                            // Return The Floor
+    }
+    case DATETIMEFUNCTIONS_PERIOD_DAY:                                  // Day
+      _index = _Z;                                                      // Day Number
+      _next = _DAY + 86400ULL;                                          // Next Day
+      return _DAY;                                                      // Return The Floor
+    case DATETIMEFUNCTIONS_PERIOD_WEEK: {                               // ISO Week - 01/03/0000 Was A Wednesday
+      const uint32_t _MON = _Z - (_Z + 2UL) % 7UL;                      // Monday Of The Week
+      _index = (_Z + 2UL) / 7UL;                                        // Week Number
+      _next = (uint64_t)(_MON + 7UL) * 86400ULL;                        // Next Monday
+      return (uint64_t)_MON * 86400ULL;                                 // Return The Floor
+    }
+    case DATETIMEFUNCTIONS_PERIOD_MONTH:                                // Month, Quarter & Year - Days From Civil
+    case DATETIMEFUNCTIONS_PERIOD_QUARTER:
+    case DATETIMEFUNCTIONS_PERIOD_YEAR: {
+      const uint32_t _ERA = _Z / 146097UL;                              // 400.Year Era
+      const uint32_t _DOE = _Z - _ERA * 146097UL;                       // Day Of Era   [0, 146096]
+      const uint32_t _YOE = (_DOE - _DOE / 1460UL + _DOE / 36524UL - _DOE / 146096UL) / 365UL; // Year Of Era [0, 399]
+      const uint16_t _DOY = _DOE - (365UL * _YOE + _YOE / 4UL - _YOE / 100UL); // Day Of Year From 01/03 [0, 365]
+      const uint8_t _MP = (5U * _DOY + 2U) / 153U;                      // Month From March [0, 11]
+      const uint8_t _MONTH = (_MP < 10U) ? _MP + 3U : _MP - 9U;         // Month
+      const uint16_t _YEAR = _YOE + _ERA * 400UL + (_MONTH <= 2U);      // Year
+      if (_PERIOD == DATETIMEFUNCTIONS_PERIOD_MONTH) {                  // Month
+        const uint32_t _FIRST = _Z - (_DOY - (153U * _MP + 2U) / 5U);   // Day 1 Of The Month
+        _index = (int64_t)_YEAR * 12LL + _MONTH - 1;                    // Month Number
+        _next = (uint64_t)(_MONTH == 12 ? DFC(_YEAR + 1U, 1) : DFC(_YEAR, _MONTH + 1U)) * 86400ULL; // Next Month
+        return (uint64_t)_FIRST * 86400ULL;                             // Return The Floor
+      }
+      if (_PERIOD == DATETIMEFUNCTIONS_PERIOD_QUARTER) {                // Quarter
+        const uint8_t _Q = (_MONTH - 1U) / 3U;                          // Quarter 0-3
+        _index = (int64_t)_YEAR * 4LL + _Q;                             // Quarter Number
+        _next = (uint64_t)(_Q == 3 ? DFC(_YEAR + 1U, 1) : DFC(_YEAR, _Q * 3U + 4U)) * 86400ULL; // Next Quarter
+        return (uint64_t)DFC(_YEAR, _Q * 3U + 1U) * 86400ULL;           // Return The Floor
+      }
+      _index = _YEAR;                                                   // Year Number
+      _next = (uint64_t)DFC(_YEAR + 1U, 1) * 86400ULL;                  // Next Year
+      return (uint64_t)DFC(_YEAR, 1) * 86400ULL;                        // Return The Floor
+    }
+    default:                                                            // Unknown - The Second
+      _index = (int64_t)_LOCAL;                                         // Second Number
+      _next = _LOCAL + 1ULL;                                            // Next Second
+      return _LOCAL;                                                    // Return The Time
+  }
+}
+
+// Day 1 Of A Month - Private - Returns: Days Since 01/03/0000
+uint32_t DateTimeFunctions::DFC(const uint16_t _YEAR, const uint8_t _MONTH) {
+  const uint32_t _Y = (uint32_t)_YEAR - (_MONTH <= 2U);                 // The Year Starts At 01/03
+  const uint32_t _ERA = _Y / 400UL;                                     // 400.Year Era
+  const uint32_t _YOE = _Y - _ERA * 400UL;                              // Year Of Era  [0, 399]
+  const uint16_t _DOY = (153U * (_MONTH > 2U ? _MONTH - 3U : _MONTH + 9U) + 2U) / 5U; // Day Of Year From 01/03
+  return _ERA * 146097UL + _YOE * 365UL + _YOE / 4UL - _YOE / 100UL + _DOY; // Return The Days
+}
+
+// Nth Weekday Of Month - Private - _FIRST = Weekday Of Day 1 - Returns: Day 1-31, 0 = None
+uint8_t DateTimeFunctions::NWD(const int8_t _N, const uint8_t _DOW, const uint8_t _FIRST, const uint8_t _DIM) {
+  if (_N > 0) {                                                         // From The Start
+    const uint8_t _D = 1U + (_DOW + 7U - _FIRST) % 7U + (_N - 1) * 7U;  // First One & N - 1 Weeks On
+    return (_D <= _DIM) ? _D : 0U;                                      // No 5th This Month
+  }
+  const uint8_t _LAST = _DIM - (_FIRST + _DIM - 1U + 7U - _DOW) % 7U;   // Last One - Weekday Of The Last Day Back To _DOW
+  const int8_t _D = (int8_t)_LAST + 7 * (_N + 1);                       // -N - 1 Weeks Back
+  return (_D >= 1) ? (uint8_t)_D : 0U;                                  // No 5th Last This Month
+}
+
+//------------------ Leap Seconds -----------------//
+
+// TAI - UTC is 10.seconds from 01/01/1972 and one more after each leap second (37 since 01/01/2017).
+// Unix time has no 23:59:60, the leap second has the same unix time as 23:59:59.
+// The offset of the last looked up interval is cached. While the time stays in that interval
+// (that is almost always), a lookup is one compare. Else a binary search fills the cache.
+
+// Set The Leap Second Table - setLeapTable(table, count) - NULL = Built In Table
+void DateTimeFunctions::setLeapTable(const uint32_t* _TABLE, const uint8_t _COUNT) {
+  STAT(setLeapTable);
+  // Set The Leap Second Table
+  // _TABLE: Unix time of the day after each leap second, from 01/07/1972 "78796800". Needs to stay in RAM.
+  _LEAPRAM_ = _TABLE;                                                        // Set The Table
+  _LEAPCOUNT_ = (_TABLE != NULL) ? _COUNT : sizeof(LEAP_UT) / sizeof(LEAP_UT[0]); // Set The Count
+  _LEAPSPAN_ = 0;                                                            // Empty The Cache
+}
+
+// Load The Leap Second Table - loadLeapTable(text, table, max) = Returns: Leap Seconds Loaded Or 0 On Error
+uint8_t DateTimeFunctions::loadLeapTable(const char* _LIST, uint32_t* _table, const uint8_t _MAX) {
+  STAT(loadLeapTable);
+  // Load The Leap Second Table - From The Text Of leap-seconds.list (IERS / IETF)
+  // Lines: "NTPseconds TAI-UTC # Comment". Lines that start with # are skipped.
+  // The 01/01/1972 line (10) is the start, each line after it needs to be one more.
+  // Read the file into a buffer first (SD / LittleFS / fread). _table needs to stay in RAM.
+  uint8_t _count = 0;                                                        // Leap Seconds Loaded
+  uint8_t _i = 0;                                                            // Line Index
+  const char* _p = _LIST;                                                    // Text Pointer
+  if (_LIST == NULL || _table == NULL) return 0;                             // Nothing To Load
+  while (*_p != '\0') {
+    while (*_p == ' ' || *_p == '\t') _p++;                                  // Skip The Spaces
+    if (*_p >= '0' && *_p <= '9') {                                          // Data Line
+      uint64_t _ntp = 0;                                                     // NTP Seconds
+      uint16_t _offset = 0;                                                  // TAI - UTC
+      while (*_p >= '0' && *_p <= '9') _ntp = _ntp * 10ULL + (*_p++ - '0');  // Read The NTP Seconds
+      while (*_p == ' ' || *_p == '\t') _p++;                                // Skip The Spaces
+      if (*_p < '0' || *_p > '9') return 0;                                  // Needs The Offset
+      while (*_p >= '0' && *_p <= '9' && _offset < 1000U) _offset = _offset * 10U + (*_p++ - '0'); // Read The Offset
+      if (_ntp < 2208988800ULL || _ntp - 2208988800ULL > 0xFFFFFFFFULL) return 0; // Before 1970 Or After 2106
+      const uint32_t _UT = (uint32_t)(_ntp - 2208988800ULL);                 // Unix Time
+      if (_i++ == 0 && _offset == 10U) { }                                   // 01/01/1972 - Start, Not A Leap Second
+      else if (_offset != 11U + _count || _count >= _MAX) return 0;          // Not One More Or No Room
+      else if (_count > 0 && _UT <= _table[_count - 1]) return 0;            // Not In Order
+      else _table[_count++] = _UT;                                           // Add The Leap Second
+    }
+    while (*_p != '\0' && *_p != '\n') _p++;                                // Skip To The End Of The Line
+    if (*_p == '\n') _p++;                                                   // Next Line
+  }
+  if (_count == 0) return 0;                                                 // No Leap Seconds
+  setLeapTable(_table, _count);                                              // Use The Loaded Table
+  return _count;                                                             // Return The Count
+}
+
+// Set The Leap Smear - setLeapSmear(true/false) - true = 24.hour Linear Smear & false = Step (23:59:60)
+void DateTimeFunctions::setLeapSmear(const bool _SETBOOL) {
+  STAT(setLeapSmear);
+  // Set The Leap Smear - Only Used By conTAI2UTCMs()
+  // Smear: from 12:00 UTC before to 12:00 UTC after the leap second, 86401 real seconds are shown as 86400.
+  // This is the smear that public NTP smear servers emit.
+  _LEAPSMEAR_ = _SETBOOL;                                                    // true = Smear & false = Step
+}
+
+// Get TAI - UTC - getTAIOffset(unixTime) = Returns: 10 ... 37
+uint8_t DateTimeFunctions::getTAIOffset(const int64_t _UNIXTIME) {
+  STAT(getTAIOffset);
+  // Get TAI - UTC - Before 01/01/1972 it is not a whole number, 10 is returned.
+  if ((uint64_t)_UNIXTIME - (uint64_t)_LEAPFROM_ >= _LEAPSPAN_)             // Not In The Cached Interval
+    LTC(LTS(_UNIXTIME, false));                                              // Search & Fill The Cache
+  return 10U + _LEAPINDEX_;                                                  // Return The Offset
+}
+
+// Convert Unix Time (UTC) To TAI Seconds - conUTC2TAI(unixTime) = Returns: TAI Seconds Since 01/01/1970
+int64_t DateTimeFunctions::conUTC2TAI(const int64_t _UNIXTIME) {
+  STAT(conUTC2TAI);
+  // Convert Unix Time (UTC) To TAI
+  return _UNIXTIME + getTAIOffset(_UNIXTIME);                                // Add The Offset
+}
+
+// Convert TAI Seconds To Unix Time (UTC) - conTAI2UTC(TAI) = Returns: Unix Time
+int64_t DateTimeFunctions::conTAI2UTC(const int64_t _TAI) {
+  // Convert TAI To Unix Time (UTC) - 23:59:60 Returns The Unix Time Of 23:59:59
+  bool _leapSec;                                                             // Not Used
+  return conTAI2UTC(_TAI, _leapSec);                                         // Use conTAI2UTC()
+}
+
+// Convert TAI Seconds To Unix Time (UTC) - conTAI2UTC(TAI, leapSec) = Returns: Unix Time, Sets: leapSec
+int64_t DateTimeFunctions::conTAI2UTC(const int64_t _TAI, bool& _leapSec) {
+  STAT(conTAI2UTC);
+  // Convert TAI To Unix Time (UTC)
+  // In TAI the interval also holds its leap second at the end, so it is one second longer.
+  // _leapSec is true in 23:59:60, then the unix time of 23:59:59 is returned.
+  const uint8_t _OFFSET = 10U + _LEAPINDEX_;                                 // Cached Offset
+  if (_LEAPSPAN_ == 0 || (uint64_t)_TAI - (uint64_t)_LEAPFROM_ - _OFFSET > _LEAPSPAN_) // Not In The Cached Interval
+    LTC(LTS(_TAI, true));                                                    // Search & Fill The Cache
+  int64_t _utc = _TAI - (10 + _LEAPINDEX_);                                  // Subtract The Offset
+  _leapSec = ((uint64_t)_utc - (uint64_t)_LEAPFROM_ == _LEAPSPAN_);          // Lands On The Next Leap Second
+  if (_leapSec) _utc--;                                                      // 23:59:60 = 23:59:59
+  return _utc;                                                               // Return The Unix Time
+}
+
+// Convert TAI Milliseconds To Unix Milliseconds - conTAI2UTCMs(TAIms) = Returns: Unix Milliseconds
+int64_t DateTimeFunctions::conTAI2UTCMs(const int64_t _TAIMS) {
+  STAT(conTAI2UTCMs);
+  // Convert TAI Milliseconds To Unix Milliseconds (UTC)
+  // Step:  23:59:60.xxx shows as 23:59:59.xxx, the second is repeated.
+  // Smear: 12:00 before to 12:00 after the leap second runs 86400 / 86401 slow, there is no step.
+  const int64_t _TAISEC = FDIV(_TAIMS, 1000LL);                              // TAI Seconds
+  const int64_t _UTC = conTAI2UTC(_TAISEC);                                  // Unix Time
+  if (_LEAPSMEAR_) {                                                         // Smear
+    // The Next Or The Last Leap Second Can Be Within 12.hours
+    for (uint8_t _j = (_LEAPINDEX_ > 0) ? _LEAPINDEX_ - 1 : 0; _j <= _LEAPINDEX_ && _j < _LEAPCOUNT_; _j++) {
+      const int64_t _START = (int64_t)LTE(_j) - 43200LL;                    // 12:00 UTC Before The Leap Second
+      const int64_t _ELAPSED = _TAIMS - (_START + 10 + _j) * 1000LL;         // Real Milliseconds Since 12:00
+      if (_ELAPSED >= 0 && _ELAPSED < 86401000LL)                            // In The Smear
+        return _START * 1000LL + _ELAPSED * 86400LL / 86401LL;               // Smeared Unix Milliseconds
+    }
+  }
+  return _UTC * 1000LL + (_TAIMS - _TAISEC * 1000LL);                        // Unix Milliseconds
+}
+
+// Convert TAI Seconds To Date Time - conTAI2DT(buffer, TAI, false/true) = Returns: DD/MM/YYYY - 23:59:60 Or DD/Jan/YYYY - 23:59:60
+char* DateTimeFunctions::conTAI2DT(char* _BUFFER, const int64_t _TAI, const bool _USEMONTHNAME) {
+  STAT(conTAI2DT);
+  // Convert TAI To Human Readable Format (UTC) - The Leap Second Shows As 23:59:60
+  // _BUFFER needs to be 27.bytes. Times before 01/01/1970 show as 01/01/1970.
+  bool _leapSec;                                                             // In 23:59:60
+  const int64_t _UTC = conTAI2UTC(_TAI, _leapSec);                           // Unix Time
+  uint8_t _day, _month, _hour, _min, _sec;                                   // Date Time Fields
+  uint16_t _year;                                                            // Year
+  UT2F(_UTC > 0 ? (uint64_t)_UTC : 0ULL, _day, _month, _year, _hour, _min, _sec); // Split The Unix Time
+  if (_leapSec) _sec = 60;                                                   // 23:59:60
+  return MTDTS(_BUFFER, _day, _month, _year, _hour, _min, _sec, _USEMONTHNAME ? 1 : 0); // Use MTDTS()
+}
+
+// Read Leap Table Entry - Private - Returns: Unix Time Of The Day After Leap Second _I
+uint32_t DateTimeFunctions::LTE(const uint8_t _I) {
+  if (_LEAPRAM_ != NULL) return _LEAPRAM_[_I];                               // Loaded Table
+#if DATETIMEFUNCTIONS_MEMORY_USE == 0                                        // Use Flash
+  return pgm_read_dword(&LEAP_UT[_I]);                                       // Built In Table
+#else                                                                        // Use SRAM
+  return LEAP_UT[_I];                                                        // Built In Table
+#endif
+}
+
+// Search The Leap Table - Private - Returns: Leap Seconds Before _T (UTC Or TAI)
+uint8_t DateTimeFunctions::LTS(const int64_t _T, const bool _TAI) {
+  // Binary Search - In TAI leap second _I starts at its unix time + 11 + _I
+  uint8_t _lo = 0, _hi = _LEAPCOUNT_;                                        // Search Range
+  while (_lo < _hi) {
+    const uint8_t _MID = (_lo + _hi) / 2U;                                   // Middle
+    if ((int64_t)LTE(_MID) + (_TAI ? 11 + _MID : 0) <= _T) _lo = _MID + 1;   // After This One
+    else _hi = _MID;                                                         // Before This One
+  }
+  return _lo;                                                                // Return The Count
+}
+
+// Fill The Leap Cache - Private - Interval _K Is From Leap Second _K - 1 To Leap Second _K
+void DateTimeFunctions::LTC(const uint8_t _K) {
+  _LEAPFROM_ = (_K > 0) ? (int64_t)LTE(_K - 1) : INT64_MIN;                  // Start Of The Interval
+  if (_K < _LEAPCOUNT_) _LEAPSPAN_ = (uint64_t)LTE(_K) - (uint64_t)_LEAPFROM_; // Until The Next Leap Second
+  else _LEAPSPAN_ = (uint64_t)INT64_MAX;                                     // No Next Leap Second
+  _LEAPINDEX_ = _K;                                                          // Leap Seconds Before
 }
 
 
 //--------------------- Date ----------------------//
 
+// Duration To String - dur2Str(buffer, duration, style) = Returns: 1y 2d 03:04:05 Or P1Y2DT3H4M5S Or 51:04:05
+char* DateTimeFunctions::dur2Str(char* _BUFFER, const DateTimeDuration& _DUR, const uint8_t _STYLE) {
+  STAT(dur2Str);
+  // Duration To String - Into The Caller Buffer
+  // COMPACT: 1y 2d 03:04:05 - Years & days only if not 0.
+  // ISO:     P1Y2DT3H4M5S   - ISO 8601, parts that are 0 are left out. 0 = PT0S.
+  // CLOCK:   51:04:05       - The years & days go into the hours.
+  // Millis are added as .mmm to the seconds when not 0.
+  // Max String = 4294967295y 4294967295d 23:59:59.999 = 36.characters. _BUFFER needs to be 40.bytes.
+  uint8_t _index = 0;                                                // String Index
+  if (_STYLE == DATETIMEFUNCTIONS_DURATION_ISO) {                    // P1Y2DT3H4M5S
+    _BUFFER[_index++] = 'P';                                         // Add The P
+    if (_DUR.years > 0UL) { _index += U2S(_BUFFER + _index, _DUR.years); _BUFFER[_index++] = 'Y'; }
+    if (_DUR.days > 0UL) { _index += U2S(_BUFFER + _index, _DUR.days); _BUFFER[_index++] = 'D'; }
+    const bool _NODATE = (_index == 1);                              // Only The P So Far
+    if (_DUR.hours > 0 || _DUR.minutes > 0 || _DUR.seconds > 0 || _DUR.millis > 0U || _NODATE) {
+      _BUFFER[_index++] = 'T';                                       // Add The T
+      if (_DUR.hours > 0) { _index += U2S(_BUFFER + _index, _DUR.hours); _BUFFER[_index++] = 'H'; }
+      if (_DUR.minutes > 0) { _index += U2S(_BUFFER + _index, _DUR.minutes); _BUFFER[_index++] = 'M'; }
+      if (_DUR.seconds > 0 || _DUR.millis > 0U || _BUFFER[_index - 1] == 'T') { // Seconds, Or PT0S
+        _index += U2S(_BUFFER + _index, _DUR.seconds);               // Add The Seconds
+        if (_DUR.millis > 0U) {                                      // Add The Millis
+          _BUFFER[_index++] = '.';                                   // Add The .
+          _BUFFER[_index++] = (_DUR.millis / 100U) + '0';            // Add The First Digit In Millis
+          _BUFFER[_index++] = (_DUR.millis / 10U) % 10U + '0';       // Add The Second Digit In Millis
+          _BUFFER[_index++] = _DUR.millis % 10U + '0';               // Add The Third Digit In Millis
+        }
+        _BUFFER[_index++] = 'S';                                     // Add The S
+      }
+    }
+    _BUFFER[_index] = '\0';                                          // Null Terminate The String
+    return _BUFFER;                                                  // Return The String
+  }
+
+  // Hours
+  if (_STYLE == DATETIMEFUNCTIONS_DURATION_CLOCK) {                  // 51:04:05
+    const uint64_t _HOURS = ((uint64_t)_DUR.years * 365ULL + _DUR.days) * 24ULL + _DUR.hours;
+    if (_HOURS < 10ULL) _BUFFER[_index++] = '0';                     // Add The First Digit In Hours
+    _index += U2S(_BUFFER + _index, _HOURS);                         // Add The Hours
+  }
+  else {                                                             // 1y 2d 03:04:05
+    if (_DUR.years > 0UL) { _index += U2S(_BUFFER + _index, _DUR.years); _BUFFER[_index++] = 'y'; _BUFFER[_index++] = ' '; }
+    if (_DUR.days > 0UL) { _index += U2S(_BUFFER + _index, _DUR.days); _BUFFER[_index++] = 'd'; _BUFFER[_index++] = ' '; }
+    _BUFFER[_index++] = (_DUR.hours / 10) + '0';                     // Add The First Digit In Hours
+    _BUFFER[_index++] = (_DUR.hours % 10) + '0';                     // Add The Second Digit In Hours
+  }
+  _BUFFER[_index++] = ':';                                           // Add The :
+  // Minutes
+  _BUFFER[_index++] = (_DUR.minutes / 10) + '0';                     // Add The First Digit In Minutes
+  _BUFFER[_index++] = (_DUR.minutes % 10) + '0';                     // Add The Second Digit In Minutes
+  _BUFFER[_index++] = ':';                                           // Add The :
+  // Seconds
+  _BUFFER[_index++] = (_DUR.seconds / 10) + '0';                     // Add The First Digit In Seconds
+  _BUFFER[_index++] = (_DUR.seconds % 10) + '0';                     // Add The Second Digit In Seconds
+  // Millis
+  if (_DUR.millis > 0U) {                                            // Add The Millis
+    _BUFFER[_index++] = '.';                                         // Add The .
+    _BUFFER[_index++] = (_DUR.millis / 100U) + '0';                  // Add The First Digit In Millis
+    _BUFFER[_index++] = (_DUR.millis / 10U) % 10U + '0';             // Add The Second Digit In Millis
+    _BUFFER[_index++] = _DUR.millis % 10U + '0';                     // Add The Third Digit In Millis
+  }
+  _BUFFER[_index] = '\0';                                            // Null Terminate The String
+  return _BUFFER;                                                    // Return The String
+}
+
+// Make The Number String - Private - Returns: String Length (Not Null Terminated)
+uint8_t DateTimeFunctions::U2S(char* _buffer, const uint64_t _IN) {
+  // Make The Number String - 32.bit Math Unless The Number Needs 64.bits
+  char _digits[20];                                                  // Digits In Reverse
+  uint8_t _count = 0;                                                // Digit Count
+  uint64_t _in = _IN;                                                // Value Left
+  while (_in > 0xFFFFFFFFULL) {                                      // 64.bit Part
+    _digits[_count++] = (_in % 10ULL) + '0';                         // Add The Digit
+    _in /= 10ULL;                                                    // Next Digit
+  }
+  uint32_t _in32 = (uint32_t)_in;                                    // 32.bit Part
+  do {
+    _digits[_count++] = (_in32 % 10UL) + '0';                        // Add The Digit
+    _in32 /= 10UL;                                                   // Next Digit
+  } while (_in32 > 0UL);
+  for (uint8_t _i = 0; _i < _count; _i++) _buffer[_i] = _digits[_count - 1 - _i]; // Reverse Into The Buffer
+  return _count;                                                     // Return The Length
+}
+
 // Date To String - conDate2Str(day, month, year, false/true) = Returns: DD/MM/YYYY Or DD/Jan/YYYY
 char* DateTimeFunctions::date2Str(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const bool _USEMONTHNAME) {
+  STAT(date2Str);
   // Date To String
   // Max String = DD/MMM/YYYY = 11.characters.
   if (_USEMONTHNAME) return MTDTS(_DAY, _MONTH, _YEAR, 0, 0, 0, 3); // Use MTDTS() - Type 3
   else return MTDTS(_DAY, _MONTH, _YEAR, 0, 0, 0, 2);               // Use MTDTS() - Type 2
 }
 
+// Month Grid To Text - grid2Str(buffer, grid, true/false) = Returns: The Month Calendar Text
+char* DateTimeFunctions::grid2Str(char* _BUFFER, const DateTimeMonthGrid& _GRID, const bool _USEWEEKS) {
+  STAT(grid2Str);
+  // Month Grid To Text - One Line Per Row, Today Is Marked With *
+  //  November 2023
+  // Wk Mo Tu We Th Fr Sa Su
+  // 44        1  2  3  4  5
+  // 46 13*14 15 16 17 18 19
+  // Each cell has the * or a space before it, also in the first column when there are no weeks.
+  // The rows have no spaces at the end. _BUFFER needs to be DATETIMEFUNCTIONS_GRID_TEXT (186) bytes.
+  uint8_t _index = 0;                                                   // String Index
+  // Title
+  _BUFFER[_index++] = ' ';                                              // Add The Space
+  #if DATETIMEFUNCTIONS_MEMORY_USE == 0                                 // Use Flash
+    strcpy_P(_BUFFER + _index, MONTHNAME_L[_GRID.month - 1]);           // Add The Month Name - Use Flash
+  #else                                                                 // Use SRAM
+    strcpy(_BUFFER + _index, MONTHNAME_L[_GRID.month - 1]);             // Add The Month Name - Use SRAM
+  #endif
+  _index += strlen(_BUFFER + _index);                                   // Move To The End
+  _BUFFER[_index++] = ' ';                                              // Add The Space
+  _index += AYR(_BUFFER + _index, _GRID.year);                          // Add The Year
+  _BUFFER[_index++] = '\n';                                             // Add The New Line
+  // Day Names
+  if (_USEWEEKS) { _BUFFER[_index++] = 'W'; _BUFFER[_index++] = 'k'; }  // Add The Week Column
+  for (uint8_t _col = 0; _col < 7; _col++) {
+    const uint8_t _DOW = (_col + (_GRID.mondayFirst ? 1U : 0U)) % 7U;  // Day Of Week Of The Column
+    _BUFFER[_index++] = ' ';                                            // Add The Space
+    #if DATETIMEFUNCTIONS_MEMORY_USE == 0                               // Use Flash
+      _BUFFER[_index++] = (char)PM(&(DAYNAME_S[_DOW][0]));              // Add The First Character
+      _BUFFER[_index++] = (char)PM(&(DAYNAME_S[_DOW][1]));              // Add The Second Character
+    #else                                                               // Use SRAM
+      _BUFFER[_index++] = DAYNAME_S[_DOW][0];                           // Add The First Character
+      _BUFFER[_index++] = DAYNAME_S[_DOW][1];                           // Add The Second Character
+    #endif
+  }
+  _BUFFER[_index++] = '\n';                                             // Add The New Line
+  // Rows
+  for (uint8_t _row = 0; _row < _GRID.rows; _row++) {
+    if (_USEWEEKS) _index += A2D(_BUFFER + _index, _GRID.week[_row], true); // Add The Week
+    for (uint8_t _col = 0; _col < 7; _col++) {
+      const uint8_t _CELL = _row * 7U + _col;                           // The Cell
+      _BUFFER[_index++] = (_CELL == _GRID.today) ? '*' : ' ';           // Add The Space Or Today
+      if ((_GRID.inMonth[_row] >> _col) & 1U) {                         // Add The Day
+        if (_GRID.day[_CELL] < 10) _BUFFER[_index++] = ' ';             // Add The Space
+        _index += A2D(_BUFFER + _index, _GRID.day[_CELL], false);       // Add The Day
+      }
+      else { _BUFFER[_index++] = ' '; _BUFFER[_index++] = ' '; }        // Not In The Month
+    }
+    while (_BUFFER[_index - 1] == ' ') _index--;                        // Trim The End Of The Row
+    _BUFFER[_index++] = '\n';                                           // Add The New Line
+  }
+  _BUFFER[_index] = '\0';                                               // Null Terminate The String
+  return _BUFFER;                                                       // Return The String
+}
+
 
 //--------------------- Clock ---------------------//
 
 // Make The Clock String - Private
 char* DateTimeFunctions::MTCS(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const bool _USESEC, const bool _AMPM) {
+  STAT(MTCS);
   // Make The Clock String
   // _AMPM: false = 24.h & 12.h / true = 12.h With AM/PM
+  // _SEC: 0-59, or 60 in a leap second.
   // Max String = HH:MM:SS XX = 11.characters.
   char* _buffer = __dateTimeStaticBuffer;                     // String Buffer
   uint8_t _index = 0;                                         // String Index
@@ -1331,6 +2650,7 @@ char* DateTimeFunctions::MTCS(const uint8_t _HOUR, const uint8_t _MIN, const uin
 // Clock To String - clock2Str(hour, minute, seconds, false/true) = Returns: 10:10 / 10:10:10
 // bool: false = "10:10" & true = "10:10:10"
 char* DateTimeFunctions::clock2Str(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const bool _USESEC) {
+  STAT(clock2Str);
   // Clock To String
   // Max String = 10:10:10 = 8.characters.
   return MTCS(_HOUR, _MIN, _SEC, _USESEC, false);             // Use MTCS()
@@ -1339,6 +2659,7 @@ char* DateTimeFunctions::clock2Str(const uint8_t _HOUR, const uint8_t _MIN, cons
 // Clock To String With AM / PM - clock2StrAMPM(hour, minute, seconds, false/true) = Returns: 10:10 / 10:10:10
 // bool: false = "10:10 AM" & true = "10:10:10 AM"
 char* DateTimeFunctions::clock2StrAMPM(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const bool _USESEC) {
+  STAT(clock2StrAMPM);
   // Clock To String 12.hour With AM / PM
   // Max String = 10:10:10 XX = 11.characters.
   return MTCS(_HOUR, _MIN, _SEC, _USESEC, true);              // Use MTCS()
@@ -1347,6 +2668,7 @@ char* DateTimeFunctions::clock2StrAMPM(const uint8_t _HOUR, const uint8_t _MIN,
 // Seconds To Clock - sec2Clock(seconds, false/true) = Returns: 10:10 / 10:10:10
 // bool: false = "10:10" & true = "10:10:10"
 char* DateTimeFunctions::sec2Clock(const uint32_t _SECONDS, const bool _USESEC) {
+  STAT(sec2Clock);
   // Seconds To Clock
   // Max String = 10:10:10 = 8.characters.
   const uint8_t _SEC  = _SECONDS % 60UL;                      // Calculate The Seconds
@@ -1358,6 +2680,7 @@ char* DateTimeFunctions::sec2Clock(const uint32_t _SECONDS, const bool _USESEC)
 // Seconds To Clock With AM / PM - sec2ClockAMPM(seconds, false/true) = Returns: 10:10 AM / 10:10:10 AM
 // bool: false = "10:10 AM" & true = "10:10:10 AM"
 char* DateTimeFunctions::sec2ClockAMPM(const uint32_t _SECONDS, const bool _USESEC) {
+  STAT(sec2ClockAMPM);
   // Seconds To Clock 12.hour With AM / PM
   // Max String = 10:10:10 XX = 11.characters.
   const uint8_t _SEC  = _SECONDS % 60UL;                      // Calculate The Seconds
@@ -1368,26 +2691,248 @@ char* DateTimeFunctions::sec2ClockAMPM(const uint32_t _SECONDS, const bool _USES
 
 // Roman Clock 24.hours - romanClock(hour, minute) = Returns: N:N ... XXIII:LIX
 char* DateTimeFunctions::romanClock(const uint8_t _HOUR, const uint8_t _MIN) {
+  STAT(romanClock);
   // Roman Clock 24.hours
+  // Max String = XVIII:XXXVIII = 13.characters.
   char* _buffer = __dateTimeStaticBuffer;                         // String Buffer
-  char romanClockH[6];                                            // Hour String
-  char romanClockM[6];                                            // Minute String
-  strcpy(romanClockH, conNum2Roman(_HOUR));                       // Convert The Hours
-  strcpy(romanClockM, conNum2Roman(_MIN));                        // Convert The Minutes
-  #if DATETIMEFUNCTIONS_MEMORY_USE == 0                           // Use Flash
-    sprintf_P(_buffer, PSTR("%s:%s"), romanClockH, romanClockM);  // Make The String
-  #else                                                           // Use SRAM
-    sprintf(_buffer, "%s:%s", romanClockH, romanClockM);          // Make The String
-  #endif
+  uint8_t _index = N2R(_buffer, _HOUR);                           // Add The Hours
+  _buffer[_index++] = ':';                                        // Add The :
+  _index += N2R(_buffer + _index, _MIN);                          // Add The Minutes
+  _buffer[_index] = '\0';                                         // Null Terminate The String
   return _buffer;                                                 // Return The String
 }
 
 // Roman Clock 12.hours - romanClock12(hour, minute) = Returns: I:N ... XI:LIX
 char* DateTimeFunctions::romanClock12(const uint8_t _HOUR, const uint8_t _MIN) {
+  STAT(romanClock12);
   // Roman Clock 12.hours
   const uint8_t _hour = con24To12(_HOUR);                       // Convert 24.h To 12.h
   return romanClock(_hour, _MIN);                               // Use The romanClock()
 }
 
+// TAI Seconds To Clock - tai2Clock(TAI, false/true) = Returns: 23:59 / 23:59:60
+// bool: false = "23:59" & true = "23:59:60"
+char* DateTimeFunctions::tai2Clock(const int64_t _TAI, const bool _USESEC) {
+  STAT(tai2Clock);
+  // TAI Seconds To Clock (UTC) - The Leap Second Shows As 60.
+  // Max String = 23:59:60 XX = 11.characters.
+  bool _leapSec;                                                // In 23:59:60
+  const int64_t _UTC = conTAI2UTC(_TAI, _leapSec);              // Unix Time
+  const uint32_t _SOD = _UTC - FDIV(_UTC, 86400LL) * 86400LL;   // Seconds Of Day
+  const uint8_t _SEC  = _leapSec ? 60 : _SOD % 60UL;            // Calculate The Seconds
+  const uint8_t _MIN  = (_SOD / 60UL) % 60UL;                   // Calculate The Minutes
+  const uint8_t _HOUR = (_SOD / 3600UL) % 24UL;                 // Calculate The Hours
+  return MTCS(_HOUR, _MIN, _SEC, _USESEC, false);               // Use MTCS()
+}
+
+
+//--------------------- Print ---------------------//
+
+// Print Unix Time As Date Time - printDateTime(Serial, unixTime, false/true) = Returns: Characters Written
+size_t DateTimeFunctions::printDateTime(Print& _out, const uint64_t _UNIXTIME, const bool _USEMONTHNAME) {
+  STAT(printDateTime);
+  // Print The Same As conUT2DT() - Straight To The Stream, No Buffer & No Static State
+  uint8_t _day, _month, _hour, _min, _sec;                    // Date Time Fields
+  uint16_t _year;                                             // Year
+  UT2F(_UNIXTIME, _day, _month, _year, _hour, _min, _sec);    // Split The Unix Time
+  size_t _n = PDF(_out, _day, _month, _year, _USEMONTHNAME);  // Print The Date
+  _n += _out.write(' ');                                      // Print The Space
+  _n += _out.write('-');                                      // Print The -
+  _n += _out.write(' ');                                      // Print The Space
+  _n += PCF(_out, _hour, _min, _sec, true, !_CLOCKFORMAT_);   // Print The Clock - AM / PM In 12.Hours
+  return _n;                                                  // Return The Characters Written
+}
+
+// Print Date - printDate(Serial, day, month, year, false/true) = Returns: Characters Written
+size_t DateTimeFunctions::printDate(Print& _out, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const bool _USEMONTHNAME) {
+  STAT(printDate);
+  // Print The Same As date2Str()
+  return PDF(_out, _DAY, _MONTH, _YEAR, _USEMONTHNAME);       // Print The Date
+}
+
+// Print Clock - printClock(Serial, hour, min, sec, false/true, false/true) = Returns: Characters Written
+size_t DateTimeFunctions::printClock(Print& _out, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const bool _USESEC, const bool _AMPM) {
+  STAT(printClock);
+  // Print The Same As clock2Str() Or clock2StrAMPM() (_AMPM = true)
+  return PCF(_out, _HOUR, _MIN, _SEC, _USESEC, _AMPM);        // Print The Clock
+}
+
+// Print Duration - printDuration(Serial, dur, style) = Returns: Characters Written
+size_t DateTimeFunctions::printDuration(Print& _out, const DateTimeDuration& _DUR, const uint8_t _STYLE) {
+  STAT(printDuration);
+  // Print The Same As dur2Str()
+  size_t _n = 0;                                                     // Characters Written
+  if (_STYLE == DATETIMEFUNCTIONS_DURATION_ISO) {                    // P1Y2DT3H4M5S
+    _n += _out.write('P');                                           // Print The P
+    if (_DUR.years > 0UL) { _n += PUN(_out, _DUR.years); _n += _out.write('Y'); }
+    if (_DUR.days > 0UL) { _n += PUN(_out, _DUR.days); _n += _out.write('D'); }
+    const bool _NODATE = (_DUR.years == 0UL && _DUR.days == 0UL);    // Only The P So Far
+    if (_DUR.hours > 0 || _DUR.minutes > 0 || _DUR.seconds > 0 || _DUR.millis > 0U || _NODATE) {
+      _n += _out.write('T');                                         // Print The T
+      if (_DUR.hours > 0) { _n += PUN(_out, _DUR.hours); _n += _out.write('H'); }
+      if (_DUR.minutes > 0) { _n += PUN(_out, _DUR.minutes); _n += _out.write('M'); }
+      if (_DUR.seconds > 0 || _DUR.millis > 0U || (_DUR.hours == 0 && _DUR.minutes == 0)) { // Seconds, Or PT0S
+        _n += PUN(_out, _DUR.seconds);                               // Print The Seconds
+        if (_DUR.millis > 0U) {                                      // Print The Millis
+          _n += _out.write('.');                                     // Print The .
+          _n += P2D(_out, _DUR.millis / 10U, true);                  // Print The First Two Digits In Millis
+          _n += _out.write(_DUR.millis % 10U + '0');                 // Print The Third Digit In Millis
+        }
+        _n += _out.write('S');                                       // Print The S
+      }
+    }
+    return _n;                                                       // Return The Characters Written
+  }
+
+  // Hours
+  if (_STYLE == DATETIMEFUNCTIONS_DURATION_CLOCK) {                  // 51:04:05
+    const uint64_t _HOURS = ((uint64_t)_DUR.years * 365ULL + _DUR.days) * 24ULL + _DUR.hours;
+    if (_HOURS < 10ULL) _n += _out.write('0');                       // Print The First Digit In Hours
+    _n += PUN(_out, _HOURS);                                         // Print The Hours
+  }
+  else {                                                             // 1y 2d 03:04:05
+    if (_DUR.years > 0UL) { _n += PUN(_out, _DUR.years); _n += _out.write('y'); _n += _out.write(' '); }
+    if (_DUR.days > 0UL) { _n += PUN(_out, _DUR.days); _n += _out.write('d'); _n += _out.write(' '); }
+    _n += P2D(_out, _DUR.hours, true);                               // Print The Hours
+  }
+  _n += _out.write(':');                                             // Print The :
+  _n += P2D(_out, _DUR.minutes, true);                               // Print The Minutes
+  _n += _out.write(':');                                             // Print The :
+  _n += P2D(_out, _DUR.seconds, true);                               // Print The Seconds
+  if (_DUR.millis > 0U) {                                            // Print The Millis
+    _n += _out.write('.');                                           // Print The .
+    _n += P2D(_out, _DUR.millis / 10U, true);                        // Print The First Two Digits In Millis
+    _n += _out.write(_DUR.millis % 10U + '0');                       // Print The Third Digit In Millis
+  }
+  return _n;                                                         // Return The Characters Written
+}
+
+// Print Two Digits - Private - Returns: 1-2 (First Digit Only If _ZERO Or 10+)
+size_t DateTimeFunctions::P2D(Print& _out, const uint8_t _IN, const bool _ZERO) {
+  size_t _n = 0;                                                     // Characters Written
+  if (_ZERO || _IN >= 10) _n += _out.write((_IN / 10) + '0');        // Print The First Digit
+  _n += _out.write((_IN % 10) + '0');                                // Print The Second Digit
+  return _n;                                                         // Return The Characters Written
+}
+
+// Print A Number - Private - Returns: 1-20 (No Leading Zeros)
+size_t DateTimeFunctions::PUN(Print& _out, const uint64_t _IN) {
+  // Digits From The Top - The Biggest Power Of 10 First, So No Buffer Is Needed
+  uint64_t _div = 1ULL;                                              // Power Of 10
+  while (_IN / _div >= 10ULL) _div *= 10ULL;                         // Find The First Digit
+  size_t _n = 0;                                                     // Characters Written
+  for (; _div > 0ULL; _div /= 10ULL) _n += _out.write((uint8_t)((_IN / _div) % 10ULL) + '0'); // Print The Digits
+  return _n;                                                         // Return The Characters Written
+}
+
+// Print The Date - Private - Returns: Characters Written
+size_t DateTimeFunctions::PDF(Print& _out, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const bool _USEMONTHNAME) {
+  size_t _n = 0;                                                     // Characters Written
+  uint8_t _order = DFO();                                            // Field Order
+  for (uint8_t _field = 0; _field < 3; _field++, _order >>= 2) {
+    if (_field > 0) _n += _out.write('/');                           // Print The /
+    if ((_order & 3) == 0) _n += P2D(_out, _DAY, _USEDATEZERO_);     // Print The Day
+    else if ((_order & 3) == 2) _n += PUN(_out, _YEAR);              // Print The Year
+    else if (!_USEMONTHNAME) _n += P2D(_out, _MONTH, _USEDATEZERO_); // Print The Month
+    else {                                                           // Print The Month Name
+      for (uint8_t _c = 0; _c < 3; _c++) {
+        #if DATETIMEFUNCTIONS_MEMORY_USE == 0                        // Use Flash
+          _n += _out.write(PM(&(MONTHNAME_S[_MONTH - 1][_c])));      // Print The Character
+        #else                                                        // Use SRAM
+          _n += _out.write(MONTHNAME_S[_MONTH - 1][_c]);             // Print The Character
+        #endif
+      }
+    }
+  }
+  return _n;                                                         // Return The Characters Written
+}
+
+// Print The Clock - Private - Returns: Characters Written
+size_t DateTimeFunctions::PCF(Print& _out, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const bool _USESEC, const bool _AMPM) {
+  // The Same As MTCS()
+  uint8_t _hour = _HOUR;                                             // Get The Hour
+  if ((_HOUR > 12 || _HOUR == 0) && (_AMPM || !_CLOCKFORMAT_))       // We Need To Convert 24.h To 12.h
+    _hour = con24To12(_HOUR);                                        // Convert 24.h To 12.h
+  size_t _n = P2D(_out, _hour, _USEHOURZERO_);                       // Print The Hours
+  _n += _out.write(':');                                             // Print The :
+  _n += P2D(_out, _MIN, true);                                       // Print The Minutes
+  if (_USESEC) {                                                     // Print Seconds
+    _n += _out.write(':');                                           // Print The :
+    _n += P2D(_out, _SEC, true);                                     // Print The Seconds
+  }
+  if (_AMPM) {                                                       // Print The AM / PM
+    _n += _out.write(' ');                                           // Print The Space
+    _n += _out.write(_HOUR >= 12 ? 'P' : 'A');                       // Print The P Or A
+    _n += _out.write('M');                                           // Print The M
+  }
+  return _n;                                                         // Return The Characters Written
+}
+
+
+//--------------------- Stats ---------------------//
+#if DATETIMEFUNCTIONS_STATS                            // Instrumentation
+
+// Get The Stats Snapshot - getStats(stats) = Sets: stats.calls[] & stats.cycles[]
+void DateTimeFunctions::getStats(DateTimeFunctionsStats& _stats) {
+  // Get The Stats Snapshot
+  // Index with DATETIMEFUNCTIONS_STAT_conUT2DT ... The cycles are CPU cycles on ESP32 & ESP8266,
+  // micros() on other Arduino boards and rdtsc (x86) or nanoseconds on the host.
+  _stats = __stats;                                                  // Copy The Stats
+}
+
+// Reset The Stats - resetStats()
+void DateTimeFunctions::resetStats() {
+  // Reset The Stats
+  memset(&__stats, 0, sizeof(__stats));                              // Clear Calls & Cycles
+}
+
+// Print The Stats - dumpStats(Serial) = Prints: name calls cycles cycles/call - One Line Per Called Function
+void DateTimeFunctions::dumpStats(Print& _out) {
+  // Print The Stats - Host: DateTimePrint<FILE> out(*stdout); dumpStats(out);
+  char _line[DATETIMEFUNCTIONS_STAT_LINE];                           // Line Buffer
+  for (uint8_t _id = 0; _id < DATETIMEFUNCTIONS_STAT_COUNT; _id++) {
+    if (__stats.calls[_id] == 0UL || MSL(_line, _id) == 0) continue; // Not Called
+    _out.write(_line);                                               // Print The Line
+    _out.write((uint8_t)'\n');                                       // Print The New Line
+  }
+}
+
+// Read The Cycle Counter - Private
+DateTimeFunctions::CCT DateTimeFunctions::RCC() {
+  // Read The Cycle Counter
+#if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_ESP8266)
+  return ESP.getCycleCount();                                        // CPU Cycles
+#elif defined(ARDUINO)
+  return micros();                                                   // Microseconds
+#elif defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();                                                  // Time Stamp Counter
+#else
+  struct timespec _ts;                                               // Time
+  clock_gettime(CLOCK_MONOTONIC, &_ts);                              // Read The Clock
+  return (uint64_t)_ts.tv_sec * 1000000000ULL + _ts.tv_nsec;         // Nanoseconds
+#endif
+}
+
+// Make The Stats Line - Private - Returns: String Length
+uint8_t DateTimeFunctions::MSL(char* _buffer, const uint8_t _ID) {
+  // Make The Stats Line - "conUT2DT          12 3456 288"
+  // Max String = 23 + 1 + 10 + 1 + 20 + 1 + 20 = 76.characters - Name, Calls (32.bit) & Cycles (64.bit).
+  uint16_t _n = 0;                                                   // Name Start
+  for (uint8_t _i = 0; _i < _ID; _i++) _n += strlen_P(STATNAMES + _n) + 1; // Skip The Names Before
+  uint8_t _index = 0;                                                // String Index
+  while (PM(STATNAMES + _n + _index) != '\0') { _buffer[_index] = PM(STATNAMES + _n + _index); _index++; } // Add The Name
+  while (_index < 17) _buffer[_index++] = ' ';                       // Pad The Name
+  _buffer[_index++] = ' ';                                           // Add The Space
+  _index += U2S(_buffer + _index, __stats.calls[_ID]);               // Add The Calls
+  _buffer[_index++] = ' ';                                           // Add The Space
+  _index += U2S(_buffer + _index, __stats.cycles[_ID]);              // Add The Cycles
+  _buffer[_index++] = ' ';                                           // Add The Space
+  _index += U2S(_buffer + _index, __stats.cycles[_ID] / __stats.calls[_ID]); // Add The Cycles Per Call
+  _buffer[_index] = '\0';                                            // Null Terminate The String
+  return _index;                                                     // Return The Length
+}
+
+#endif
+
 
 // End Of File.
@@ -16,8 +16,196 @@
 // Use FLASH or SRAM Memory
 #define DATETIMEFUNCTIONS_MEMORY_USE 0               // Use this memory. Flash = 0 & SRAM = 1>
 
+// Kernel Profile: Small = No Tables & Loops (Less Flash) & Fast = Lookup Tables, Unrolled Digits & Closed Form Math
+#define DATETIMEFUNCTIONS_PROFILE_SMALL 0            // Small Profile
+#define DATETIMEFUNCTIONS_PROFILE_FAST  1            // Fast Profile
+#ifndef DATETIMEFUNCTIONS_PROFILE                    // Can Also Be Set With -DDATETIMEFUNCTIONS_PROFILE=0/1
+  #if defined(__AVR__)                               // AVR - Flash Is King
+    #define DATETIMEFUNCTIONS_PROFILE DATETIMEFUNCTIONS_PROFILE_SMALL
+  #else                                              // ESP32, ESP8266, ARM & Host - Speed Is King
+    #define DATETIMEFUNCTIONS_PROFILE DATETIMEFUNCTIONS_PROFILE_FAST
+  #endif
+#endif
+
+// Epochs For conEpoch2UT() & conUT2Epoch()
+#define DATETIMEFUNCTIONS_EPOCH_NTP      1           // NTP Seconds        - 01/01/1900 (Era 0 & 1)
+#define DATETIMEFUNCTIONS_EPOCH_GPS      2           // GPS Seconds        - 06/01/1980 (Week * 604800 + Seconds Of Week, 18 Leap Seconds)
+#define DATETIMEFUNCTIONS_EPOCH_EXCEL    3           // Excel Serial Day   - 1900 Date System
+#define DATETIMEFUNCTIONS_EPOCH_FILETIME 4           // Windows FILETIME   - 01/01/1601 (100.ns)
+#define DATETIMEFUNCTIONS_EPOCH_TICKS    5           // .NET Ticks         - 01/01/0001 (100.ns)
+
+// RTC Chips For The BCD Register Blocks - 7.bytes From The Seconds Register
+#define DATETIMEFUNCTIONS_RTC_DS1307     0           // DS1307  - Sec, Min, Hour, Day Of Week 1-7, Day, Month, Year (2000-2099)
+#define DATETIMEFUNCTIONS_RTC_DS3231     1           // DS3231  - As DS1307, Month Bit 7 = Century (2000-2199)
+#define DATETIMEFUNCTIONS_RTC_PCF8563    2           // PCF8563 - Sec, Min, Hour, Day, Day Of Week 0-6, Month (Bit 7 = Century), Year - 24.Hour Only
+#define DATETIMEFUNCTIONS_RTC_BYTES      7           // Register Block Size
+
+// Periods For floorTo(), ceilTo() & bucketIndex()
+#define DATETIMEFUNCTIONS_PERIOD_MINUTE  0           // Minute
+#define DATETIMEFUNCTIONS_PERIOD_HOUR    1           // Hour
+#define DATETIMEFUNCTIONS_PERIOD_DAY     2           // Day
+#define DATETIMEFUNCTIONS_PERIOD_WEEK    3           // ISO Week - Starts On Monday
+#define DATETIMEFUNCTIONS_PERIOD_MONTH   4           // Month
+#define DATETIMEFUNCTIONS_PERIOD_QUARTER 5           // Quarter - Starts 01/01, 01/04, 01/07 & 01/10
+#define DATETIMEFUNCTIONS_PERIOD_YEAR    6           // Year
+
+// ISO 8601 Timestamp Parser: 1 = SSE (SSSE3 And Up) On The Host & 0 = Scalar - Set By The Compiler Flags (-msse4.1 / -march=native)
+#ifndef DATETIMEFUNCTIONS_ISO_SIMD
+  #if !defined(ARDUINO) && defined(__SSSE3__)
+    #define DATETIMEFUNCTIONS_ISO_SIMD 1             // SSE
+  #else
+    #define DATETIMEFUNCTIONS_ISO_SIMD 0             // Scalar
+  #endif
+#endif
+
+// Instrumentation: 0 = Off (No Code & No RAM) & 1 = Count Calls & Cycles Per Function - getStats() & dumpStats()
+#ifndef DATETIMEFUNCTIONS_STATS
+  #define DATETIMEFUNCTIONS_STATS 0                  // Can Also Be Set With -DDATETIMEFUNCTIONS_STATS=1
+#endif
+
+// Duration Styles For dur2Str()
+#define DATETIMEFUNCTIONS_DURATION_COMPACT 0         // 1y 2d 03:04:05
+#define DATETIMEFUNCTIONS_DURATION_ISO     1         // P1Y2DT3H4M5S (ISO 8601)
+#define DATETIMEFUNCTIONS_DURATION_CLOCK   2         // 51:04:05 (Hours Go Past 24)
+
+// Buffer Size For grid2Str() - Title, Day Names & 6.Rows With Week Numbers
+#define DATETIMEFUNCTIONS_GRID_TEXT 186
+
+// Formats For The Batch conUT2DT() & getFormatWidth() - 0-3 Use The Date & Clock Settings
+#define DATETIMEFUNCTIONS_FORMAT_DATETIME      0     // 01/01/2023 - 22:13:20
+#define DATETIMEFUNCTIONS_FORMAT_DATETIME_NAME 1     // 01/Jan/2023 - 22:13:20
+#define DATETIMEFUNCTIONS_FORMAT_DATE          2     // 01/01/2023
+#define DATETIMEFUNCTIONS_FORMAT_DATE_NAME     3     // 01/Jan/2023
+#define DATETIMEFUNCTIONS_FORMAT_ISO           4     // 2023-11-14T22:13:20Z (ISO 8601)
+#define DATETIMEFUNCTIONS_FORMAT_MAX           26    // Max Characters Per Timestamp - 31/Dec/65535 - 12:59:59 AM
+
 // Include
-#include <Arduino.h>                                 // Include The Arduino Library
+#if defined(ARDUINO)                                 // Arduino Build
+  #include <Arduino.h>                               // Include The Arduino Library
+#else                                                // Host Build (Linux Tools)
+  #include <stdint.h>                                // Fixed Width Integers
+  #include <stdio.h>                                 // sprintf()
+  #include <string.h>                                // strcpy() & strlen()
+  #ifndef PROGMEM                                    // No Flash On Host
+    #define PROGMEM
+    #define PSTR(s) (s)
+    #define F(s) (s)
+    #define pgm_read_byte_near(addr) (*(const uint8_t*)(addr))
+    #define pgm_read_word(addr) (*(addr))
+    #define pgm_read_dword(addr) (*(addr))
+    #define strcpy_P strcpy
+    #define strlen_P strlen
+    #define sprintf_P sprintf
+  #endif
+  #ifndef DATETIMEFUNCTIONS_NO_HOST_PRINT            // Define If The Host Build Has Its Own Print Class
+  // Print - The Arduino Print Class, Only write() Is Needed By printDateTime() ...
+  class Print {
+    public:
+      virtual ~Print() {}
+      virtual size_t write(uint8_t _c) = 0;                                           // Write One Character
+      size_t write(const char* _STR) {                                                // Write A String
+        size_t _n = 0;                                                                // Characters Written
+        while (*_STR) _n += write((uint8_t)*_STR++);                                  // Write The Characters
+        return _n;                                                                    // Return The Characters Written
+      }
+  };
+  // Print Sink - Any Host Stream With put(char), Like std::ostream: DateTimePrint<std::ostream> out(std::cout);
+  template <class OUT> class DateTimePrint : public Print {
+    public:
+      explicit DateTimePrint(OUT& _out) : _stream(_out) {}                            // Set The Stream
+      size_t write(uint8_t _c) { _stream.put((char)_c); return 1; }                   // Write One Character
+      using Print::write;
+    private:
+      OUT& _stream;                                                                   // The Stream
+  };
+  // Print Sink - C FILE: DateTimePrint<FILE> out(*stdout);
+  template <> class DateTimePrint<FILE> : public Print {
+    public:
+      explicit DateTimePrint(FILE& _out) : _file(&_out) {}                            // Set The File
+      size_t write(uint8_t _c) { return fputc(_c, _file) == EOF ? 0 : 1; }            // Write One Character
+      using Print::write;
+    private:
+      FILE* _file;                                                                    // The File
+  };
+  #endif
+#endif
+
+
+// Duration - Filled By conSec2Dur() & conMs2Dur()
+struct DateTimeDuration {
+  uint32_t years;                                    // Years (365.days) - Only When Asked For, Else 0
+  uint32_t days;                                     // Days
+  uint8_t  hours;                                    // Hours   0-23
+  uint8_t  minutes;                                  // Minutes 0-59
+  uint8_t  seconds;                                  // Seconds 0-59
+  uint16_t millis;                                   // Millis  0-999
+};
+
+
+// Date Time Fields - For The Batch isValidDateTime() & The RTC Registers
+struct DateTimeFields {
+  uint16_t year;                                     // Year    0-65535
+  uint8_t  month;                                    // Month   1-12
+  uint8_t  day;                                      // Day     1-31
+  uint8_t  hour;                                     // Hour    0-23
+  uint8_t  minute;                                   // Minute  0-59
+  uint8_t  second;                                   // Second  0-59 (60 At 23:59)
+};
+
+
+// Month Grid - Filled By getMonthGrid(), 6.Rows Of 7.Days
+struct DateTimeMonthGrid {
+  uint8_t  day[42];                                  // Day Of Month Per Cell, Row By Row - Days Of The Months Before & After Too
+  uint8_t  inMonth[6];                               // Bit Set = Cell Is In The Month - Bit 0 = First Column
+  uint8_t  week[6];                                  // ISO Week Per Row - The Week Of The Monday
+  uint8_t  today;                                    // Cell Of Today - 255 = Not Shown
+  uint8_t  first;                                    // Cell Of Day 1
+  uint8_t  rows;                                     // Rows Used 4-6
+  uint8_t  month;                                    // Month 1-12
+  uint16_t year;                                     // Year
+  bool     mondayFirst;                              // First Column: true = Monday & false = Sunday
+};
+
+
+#if DATETIMEFUNCTIONS_STATS                          // Instrumentation
+// Counted Functions - Public Methods, MTDTS() & MTCS()
+#define DATETIMEFUNCTIONS_STATS_LIST(X) \
+  X(setDFormat) X(setCFormat) X(setDZero) X(setHZero) X(isLeap) X(isPM) \
+  X(isValidDate) X(isValidTime) X(isValidDateTime) X(isValidDateTimeBatch) \
+  X(getDOY) X(getDOW) X(getDOWNS) X(getDOWNL) X(getWOY) X(getWIY) X(getDIY) X(getDLIY) X(getDIM) X(getEaster) X(getMonthGrid) \
+  X(nthWeekdayOfMonth) X(nthWeekdayOfMonthBatch) X(lastWeekdayOfMonth) X(lastWeekdayOfMonthBatch) X(weekdayOnOrAfter) X(weekdayOnOrBefore) \
+  X(getMNS) X(getMNL) X(getDBD) X(getSFM) X(getMFM) X(getAMPM) X(getFormatWidth) \
+  X(con24To12) X(con12To24) X(conDOY2DATE) X(conDOY2DATEChecked) X(conDOY2D) X(conDOY2M) X(conDT2UT) X(conDT2UTChecked) X(conUT2DT) X(conUT2DTBuf) X(conUT2DTFields) X(conUT2DTBatch) \
+  X(conSec2Time) X(conSec2Time64) X(conSec2Dur) X(conMs2Dur) X(conISO2Ms) X(conISO2UT) X(conISO2UTMs) X(conISO2UTBatch) X(conSec2DT) X(conSec2DTYear) \
+  X(conDT2Sec) X(conTime2Sec) X(conNum2Roman) X(conRoman2Num) X(conGre2Jul) X(conGre2JDN) X(conGre2JDNChecked) X(conJul2JDN) \
+  X(conJDN2Gre) X(conJDN2Jul) X(conJDN2MJD) X(conMJD2JDN) X(conJDN2RD) X(conRD2JDN) \
+  X(conNTP2UT) X(conUT2NTP) X(conNTPFrac2Micros) X(conMicros2NTPFrac) X(conGPS2UT) X(conUT2GPS) \
+  X(conExcel2UT) X(conUT2Excel) X(conFT2UT) X(conUT2FT) X(conTicks2UT) X(conUT2Ticks) X(conEpoch2UT) X(conUT2Epoch) \
+  X(conBCD2DT) X(conBCD2UT) X(conDT2BCD) X(conUT2BCD) \
+  X(floorTo) X(floorToBatch) X(ceilTo) X(ceilToBatch) X(bucketIndex) X(bucketIndexBatch) \
+  X(setLeapTable) X(loadLeapTable) X(setLeapSmear) X(getTAIOffset) X(conUTC2TAI) X(conTAI2UTC) X(conTAI2UTCMs) X(conTAI2DT) \
+  X(dur2Str) X(date2Str) X(grid2Str) X(clock2Str) X(clock2StrAMPM) X(sec2Clock) X(sec2ClockAMPM) X(romanClock) X(romanClock12) X(tai2Clock) \
+  X(printDateTime) X(printDate) X(printClock) X(printDuration) \
+  X(MTDTS) X(MTCS)
+
+// Counted Function Index - DATETIMEFUNCTIONS_STAT_conUT2DT ...
+#define DATETIMEFUNCTIONS_STAT_ID(_NAME) DATETIMEFUNCTIONS_STAT_##_NAME,
+enum DateTimeFunctionsStat { DATETIMEFUNCTIONS_STATS_LIST(DATETIMEFUNCTIONS_STAT_ID) DATETIMEFUNCTIONS_STAT_COUNT };
+#undef DATETIMEFUNCTIONS_STAT_ID
+
+// Cycle Source: ESP32 & ESP8266 = CPU Cycles, Other Arduino = micros(), Host = rdtsc On x86 Else Nanoseconds
+#if defined(ARDUINO) && !defined(ARDUINO_ARCH_ESP32) && !defined(ARDUINO_ARCH_ESP8266)
+  typedef uint32_t DateTimeFunctionsTicks;           // micros() - Saves RAM On Small Boards
+#else
+  typedef uint64_t DateTimeFunctionsTicks;           // Cycles Or Nanoseconds
+#endif
+
+// Stats Snapshot - Filled By getStats()
+struct DateTimeFunctionsStats {
+  uint32_t calls[DATETIMEFUNCTIONS_STAT_COUNT];      // Calls Per Function
+  DateTimeFunctionsTicks cycles[DATETIMEFUNCTIONS_STAT_COUNT]; // Cycles Per Function - Nested Calls Count In Both
+};
+#endif
 
 
 class DateTimeFunctions {
@@ -31,6 +219,10 @@ class DateTimeFunctions {
     // Check
     bool isLeap(const uint16_t _YEAR);                                                                                  // Check For Leap Year
     bool isPM(const uint8_t _HOUR);                                                                                     // Check For AM / PM
+    bool isValidDate(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);                                   // Check For Valid Date
+    bool isValidTime(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC);                                      // Check For Valid Time - 23:59:60 Is Valid
+    bool isValidDateTime(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC); // Check For Valid Date Time
+    uint16_t isValidDateTime(const DateTimeFields* _FIELDS, const uint16_t _COUNT, uint32_t* _mask);                    // Check For Valid Date Time - Batch, One Bit Per Record
     // Get
     uint16_t getDOY(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);                                    // Get Day Of Year
     uint8_t getDOW(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);                                     // Get Day Of Week
@@ -41,30 +233,99 @@ class DateTimeFunctions {
     uint16_t getDIY(const uint16_t _YEAR);                                                                              // Get Days In Year
     uint16_t getDLIY(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);                                   // Get Days Left In Year
     uint8_t getDIM(const uint8_t _MONTH, const uint16_t _YEAR);                                                         // Get Days In Month
+    void getEaster(const uint16_t _YEAR, uint8_t& _day, uint8_t& _month);                                              // Get Easter Sunday
+    uint8_t nthWeekdayOfMonth(const int8_t _N, const uint8_t _DOW, const uint8_t _MONTH, const uint16_t _YEAR);         // Get Nth Weekday Of Month - -1 = Last
+    uint16_t nthWeekdayOfMonth(const int8_t _N, const uint8_t _DOW, const uint8_t _MONTH, const uint16_t _YEAR, uint8_t* _OUT, const uint16_t _COUNT); // Get Nth Weekday Of Month For _COUNT Years
+    uint8_t lastWeekdayOfMonth(const uint8_t _DOW, const uint8_t _MONTH, const uint16_t _YEAR);                         // Get Last Weekday Of Month
+    uint16_t lastWeekdayOfMonth(const uint8_t _DOW, const uint8_t _MONTH, const uint16_t _YEAR, uint8_t* _OUT, const uint16_t _COUNT); // Get Last Weekday Of Month For _COUNT Years
+    bool weekdayOnOrAfter(const uint8_t _DOW, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, uint8_t& _day, uint8_t& _month, uint16_t& _year);  // Get The Weekday On Or After Date
+    bool weekdayOnOrBefore(const uint8_t _DOW, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, uint8_t& _day, uint8_t& _month, uint16_t& _year); // Get The Weekday On Or Before Date
+    void getMonthGrid(const uint8_t _MONTH, const uint16_t _YEAR, DateTimeMonthGrid& _grid, const bool _MONDAYFIRST = true, const uint8_t _TODAY = 0); // Get Month Calendar Grid
     char* getMNS(const uint8_t _MONTH);                                                                                 // Get Month Name Short
     char* getMNL(const uint8_t _MONTH);                                                                                 // Get Month Name Long
     uint16_t getDBD(const uint8_t _DAY1, const uint8_t _MONTH1, const uint16_t _YEAR1, const uint8_t _DAY2, const uint8_t _MONTH2, const uint16_t _YEAR2); // Get Days Between Date
     uint32_t getSFM(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC);                                       // Get Seconds From Midnight
     uint16_t getMFM(const uint8_t _HOUR, const uint8_t _MIN);                                                           // Get Minutes From Midnight
     char* getAMPM(const uint8_t _HOUR);                                                                                 // Get AM / PM
+    uint8_t getFormatWidth(const uint8_t _FORMAT);                                                                      // Get The Width Of A Format - 0 = Not Fixed, +1 Past 9999
     // Convert
     uint8_t con24To12(const uint8_t _HOUR);                                                                             // Convert 24.Hour To 12.Hour
     uint8_t con12To24(const uint8_t _HOUR, const char _AorP);                                                           // Convert 12.Hour To 24.Hour
     char* conDOY2DATE(const uint16_t _DOY, const uint16_t _YEAR, const bool _USEMONTHNAME = false);                     // Convert Day Of Year To Date
+    bool conDOY2DATE(const uint16_t _DOY, const uint16_t _YEAR, uint8_t& _day, uint8_t& _month);                       // Convert Day Of Year To Date - Checked
     uint8_t conDOY2D(const uint16_t _DOY, const uint16_t _YEAR);                                                        // Convert Day Of Year To Day
     uint8_t conDOY2M(const uint16_t _DOY, const uint16_t _YEAR);                                                        // Convert Day Of Year To Month
     uint32_t conDT2UT(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC); // Convert Date Time To Unix Time
+    bool conDT2UT(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, uint32_t& _unixTime); // Convert Date Time To Unix Time - Checked
     char* conUT2DT(const uint64_t _UNIXTIME, const bool _USEMONTHNAME = false);                                         // Convert Unix Time To Date Time
+    char* conUT2DT(char* _BUFFER, const uint64_t _UNIXTIME, const bool _USEMONTHNAME = false);                          // Convert Unix Time To Date Time - Into Caller Buffer (Reentrant)
+    void conUT2DT(const uint64_t _UNIXTIME, uint8_t& _day, uint8_t& _month, uint16_t& _year, uint8_t& _hour, uint8_t& _min, uint8_t& _sec); // Convert Unix Time To Date Time - Into Fields
+    uint16_t conUT2DT(const uint8_t _FORMAT, const uint64_t* _IN, char* _out, const uint16_t _COUNT, const uint32_t _SIZE, const char _SEP = ',', uint32_t* _offsets = NULL); // Convert Array Of Unix Time To Date Time - Into One Buffer
     char* conSec2Time(const uint32_t _SEC);                                                                             // Convert Seconds To Time
     char* conSec2Time64(const uint64_t _SEC);                                                                           // Convert Seconds To Time
+    void conSec2Dur(const uint64_t _SEC, DateTimeDuration& _dur, const bool _USEYEARS = false);                        // Convert Seconds To Duration
+    void conMs2Dur(const uint64_t _MILLIS, DateTimeDuration& _dur, const bool _USEYEARS = false);                      // Convert Milliseconds To Duration
+    bool conISO2Ms(const char* _IN, uint64_t& _millis);                                                                 // Convert ISO 8601 Duration To Milliseconds
+    bool conISO2UT(const char* _IN, uint64_t& _unixTime);                                                               // Convert ISO 8601 Timestamp To Unix Time
+    bool conISO2UT(const char* _IN, uint64_t& _unixTime, uint16_t& _millis);                                            // Convert ISO 8601 Timestamp To Unix Time & Millis
+    uint16_t conISO2UT(const char* const* _IN, uint64_t* _OUT, const uint16_t _COUNT, uint32_t* _mask);                // Convert Array Of ISO 8601 Timestamps To Unix Time
     char* conSec2DT(const uint64_t _SEC, const bool _USEMONTHNAME = false);                                             // Convert Seconds To Date Time
     char* conSec2DT(const uint32_t _SEC, const uint16_t _YEAR, const bool _USEMONTHNAME = false);                       // Convert Seconds To Date Time
     uint32_t conDT2Sec(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint32_t _HOUR, const uint32_t _MIN, const uint8_t _SEC); // Convert Date Time To Seconds
     uint32_t conTime2Sec(const uint32_t _DAYS, const uint16_t _YEARS, const uint32_t _HOURS, const uint32_t _MIN, const uint8_t _SEC); // Convert Days, Years, Hours, Minutes And Seconds To Seconds
     char* conNum2Roman(const uint16_t _IN);                                                                             // Convert Number To Roman Numerals
+    uint16_t conRoman2Num(const char* _IN);                                                                             // Convert Roman Numerals To Number
     char* conGre2Jul(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const bool _USEMONTHNAME = false); // Convert Gregorian To Julian Calendar
+    int32_t conGre2JDN(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);                                 // Convert Gregorian Date To Julian Day Number
+    bool conGre2JDN(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, int32_t& _jdn);                     // Convert Gregorian Date To Julian Day Number - Checked
+    int32_t conJul2JDN(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);                                 // Convert Julian Calendar Date To Julian Day Number
+    void conJDN2Gre(const int32_t _JDN, uint8_t& _day, uint8_t& _month, uint16_t& _year);                              // Convert Julian Day Number To Gregorian Date
+    void conJDN2Jul(const int32_t _JDN, uint8_t& _day, uint8_t& _month, uint16_t& _year);                              // Convert Julian Day Number To Julian Calendar Date
+    int32_t conJDN2MJD(const int32_t _JDN);                                                                             // Convert Julian Day Number To Modified Julian Day
+    int32_t conMJD2JDN(const int32_t _MJD);                                                                             // Convert Modified Julian Day To Julian Day Number
+    int32_t conJDN2RD(const int32_t _JDN);                                                                              // Convert Julian Day Number To Rata Die
+    int32_t conRD2JDN(const int32_t _RD);                                                                               // Convert Rata Die To Julian Day Number
+    // Epoch
+    int64_t conNTP2UT(const uint32_t _NTPSEC);                                                                          // Convert NTP Seconds To Unix Time
+    uint32_t conUT2NTP(const int64_t _UNIXTIME);                                                                        // Convert Unix Time To NTP Seconds
+    uint32_t conNTPFrac2Micros(const uint32_t _FRAC);                                                                   // Convert NTP Fraction To Microseconds
+    uint32_t conMicros2NTPFrac(const uint32_t _MICROS);                                                                 // Convert Microseconds To NTP Fraction
+    int64_t conGPS2UT(const uint16_t _WEEK, const uint32_t _TOW, const uint8_t _LEAPSEC = 18);                          // Convert GPS Week & Seconds Of Week To Unix Time
+    bool conUT2GPS(const int64_t _UNIXTIME, uint16_t& _week, uint32_t& _tow, const uint8_t _LEAPSEC = 18);             // Convert Unix Time To GPS Week & Seconds Of Week - false = Clamped
+    int64_t conExcel2UT(const uint32_t _SERIAL, const uint32_t _SFM = 0);                                               // Convert Excel Serial Day To Unix Time
+    uint32_t conUT2Excel(const int64_t _UNIXTIME);                                                                      // Convert Unix Time To Excel Serial Day - 0 = Before 1900
+    int64_t conFT2UT(const uint64_t _FILETIME);                                                                         // Convert Windows FILETIME To Unix Time
+    uint64_t conUT2FT(const int64_t _UNIXTIME);                                                                         // Convert Unix Time To Windows FILETIME
+    int64_t conTicks2UT(const uint64_t _TICKS);                                                                         // Convert .NET Ticks To Unix Time
+    uint64_t conUT2Ticks(const int64_t _UNIXTIME);                                                                      // Convert Unix Time To .NET Ticks
+    void conEpoch2UT(const uint8_t _EPOCH, const uint64_t* _IN, int64_t* _OUT, const uint16_t _COUNT);                 // Convert Array From Epoch To Unix Time
+    void conUT2Epoch(const uint8_t _EPOCH, const int64_t* _IN, uint64_t* _OUT, const uint16_t _COUNT);                 // Convert Array From Unix Time To Epoch
+    // RTC - BCD Register Blocks
+    bool conBCD2DT(const uint8_t* _REGS, DateTimeFields& _fields, const uint8_t _CHIP = DATETIMEFUNCTIONS_RTC_DS3231);  // Convert RTC Registers To Date Time Fields
+    bool conBCD2UT(const uint8_t* _REGS, uint64_t& _unixTime, const uint8_t _CHIP = DATETIMEFUNCTIONS_RTC_DS3231);      // Convert RTC Registers To Unix Time
+    bool conDT2BCD(const DateTimeFields& _FIELDS, uint8_t* _regs, const uint8_t _CHIP = DATETIMEFUNCTIONS_RTC_DS3231, const bool _USE12 = false); // Convert Date Time Fields To RTC Registers
+    bool conUT2BCD(const uint64_t _UNIXTIME, uint8_t* _regs, const uint8_t _CHIP = DATETIMEFUNCTIONS_RTC_DS3231, const bool _USE12 = false); // Convert Unix Time To RTC Registers
+    // Bucket - Floor & Ceil To A Period
+    uint64_t floorTo(const uint64_t _UNIXTIME, const uint8_t _PERIOD, const int32_t _OFFSET = 0);                      // Floor Unix Time To The Start Of The Period
+    uint64_t ceilTo(const uint64_t _UNIXTIME, const uint8_t _PERIOD, const int32_t _OFFSET = 0);                       // Ceil Unix Time To The Start Of The Next Period
+    int32_t bucketIndex(const uint64_t _UNIXTIME, const uint8_t _PERIOD, const uint64_t _ORIGIN, const int32_t _OFFSET = 0); // Get The Periods From The Origin
+    void floorTo(const uint8_t _PERIOD, const uint64_t* _IN, uint64_t* _OUT, const uint16_t _COUNT, const int32_t _OFFSET = 0); // Floor Array To The Period
+    void ceilTo(const uint8_t _PERIOD, const uint64_t* _IN, uint64_t* _OUT, const uint16_t _COUNT, const int32_t _OFFSET = 0);  // Ceil Array To The Period
+    void bucketIndex(const uint8_t _PERIOD, const uint64_t _ORIGIN, const uint64_t* _IN, int32_t* _OUT, const uint16_t _COUNT, const int32_t _OFFSET = 0); // Get The Periods From The Origin For An Array
+    // Leap Seconds
+    void setLeapTable(const uint32_t* _TABLE, const uint8_t _COUNT);                                                    // Set The Leap Second Table - Unix Times In RAM
+    uint8_t loadLeapTable(const char* _LIST, uint32_t* _table, const uint8_t _MAX);                                     // Load The Leap Second Table - From leap-seconds.list Text
+    void setLeapSmear(const bool _SETBOOL);                                                                             // Set The 24.Hour Leap Smear
+    uint8_t getTAIOffset(const int64_t _UNIXTIME);                                                                      // Get TAI - UTC Seconds
+    int64_t conUTC2TAI(const int64_t _UNIXTIME);                                                                        // Convert Unix Time (UTC) To TAI Seconds
+    int64_t conTAI2UTC(const int64_t _TAI);                                                                             // Convert TAI Seconds To Unix Time (UTC)
+    int64_t conTAI2UTC(const int64_t _TAI, bool& _leapSec);                                                             // Convert TAI Seconds To Unix Time (UTC) - true In 23:59:60
+    int64_t conTAI2UTCMs(const int64_t _TAIMS);                                                                         // Convert TAI Milliseconds To Unix Milliseconds - Smeared If Set
+    char* conTAI2DT(char* _BUFFER, const int64_t _TAI, const bool _USEMONTHNAME = false);                               // Convert TAI Seconds To Date Time - Shows 23:59:60
     // Date
+    char* dur2Str(char* _BUFFER, const DateTimeDuration& _DUR, const uint8_t _STYLE = DATETIMEFUNCTIONS_DURATION_COMPACT); // Duration To String
     char* date2Str(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const bool _USEMONTHNAME = false);   // Date To String
+    char* grid2Str(char* _BUFFER, const DateTimeMonthGrid& _GRID, const bool _USEWEEKS = true);                         // Month Grid To Text
     // Clock
     char* clock2Str(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC = 0, const bool _USESEC = false);       // Clock To String
     char* clock2StrAMPM(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC = 0, const bool _USESEC = false);   // Clock To String With AM / PM
@@ -72,8 +333,21 @@ class DateTimeFunctions {
     char* sec2ClockAMPM(const uint32_t _SECONDS, const bool _USESEC = false);                                           // Seconds To Clock 12.hour With AM / PM
     char* romanClock(const uint8_t _HOUR, const uint8_t _MIN);                                                          // Roman Clock 24.hours
     char* romanClock12(const uint8_t _HOUR, const uint8_t _MIN);                                                        // Roman Clock 12.hours
+    char* tai2Clock(const int64_t _TAI, const bool _USESEC = true);                                                     // TAI Seconds To Clock - Shows 23:59:60
+    // Print - Straight To The Stream, No Buffer
+    size_t printDateTime(Print& _out, const uint64_t _UNIXTIME, const bool _USEMONTHNAME = false);                      // Print Unix Time As Date Time
+    size_t printDate(Print& _out, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const bool _USEMONTHNAME = false); // Print Date
+    size_t printClock(Print& _out, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC = 0, const bool _USESEC = false, const bool _AMPM = false); // Print Clock
+    size_t printDuration(Print& _out, const DateTimeDuration& _DUR, const uint8_t _STYLE = DATETIMEFUNCTIONS_DURATION_COMPACT); // Print Duration
+    #if DATETIMEFUNCTIONS_STATS                                                                                         // Instrumentation
+    // Stats
+    static void getStats(DateTimeFunctionsStats& _stats);                                                               // Get The Stats Snapshot
+    static void resetStats();                                                                                           // Reset The Stats
+    static void dumpStats(Print& _out);                                                                                 // Print The Stats - Serial Or DateTimePrint<FILE>
+    #endif
     
   private:                                           // Private
+    friend class DateTimeValue;                      // DateTimeValue Makes Its Strings With MTDTS()
     #define PM pgm_read_byte_near                    // Read Progmem Integer's
     // Days In Month
     static const uint8_t DIM_N[];                    // Days In Month Normal Year
@@ -84,11 +358,61 @@ class DateTimeFunctions {
     // Day Of Week Names
     static const char DAYNAME_S[][4];                // Day Names Short
     static const char DAYNAME_L[][10];               // Day Names Full
+    // Roman Numerals
+    static const char ROMAN_S[];                     // Roman Symbols - I, V, X, L, C, D, M
+    static const uint8_t ROMAN_P[];                  // Roman Digit Patterns - 2.bit Symbol Roles Per Digit
+    #if DATETIMEFUNCTIONS_PROFILE == DATETIMEFUNCTIONS_PROFILE_FAST // Fast Profile Tables
+    static const char DIGITS2[];                     // Two Digit Strings - "00" ... "99"
+    static const uint16_t DOY_C[];                   // Days Before Each Month - Not Leap Year
+    static const char ROMAN_F[][4];                  // Roman Digits - Hundreds, Tens & Units
+    #endif
+    // Leap Seconds
+    static const uint32_t LEAP_UT[];                 // Leap Second Table - Unix Time Of The Day After Each Leap Second
     // Static String Buffer
     static char __dateTimeStaticBuffer[];            // Static Buffer
     static char __conSec2TimeBuffer[];               // Static Buffer < For conSec2Time & conSec2Time64
     // Convert - Make The Date Time String
     char* MTDTS(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const uint8_t _TYPE);
+    char* MTDTS(char* _buffer, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const uint8_t _TYPE);
+    uint8_t MTS(char* _buffer, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const uint8_t _TYPE); // Returns: Length
+    // Convert - Split Unix Time To Date Time Fields
+    void UT2F(const uint64_t _UNIXTIME, uint8_t& _day, uint8_t& _month, uint16_t& _year, uint8_t& _hour, uint8_t& _min, uint8_t& _sec);
+    // Convert - ISO 8601 Timestamp To Unix Time & Millis - SSE Or Scalar
+    static bool I2U(const char* _IN, uint64_t& _unixTime, uint16_t& _millis);
+    // Epoch - Floor Division
+    static int64_t FDIV(const int64_t _A, const int64_t _B);
+    // RTC - BCD Registers To Fields & Fields To BCD Registers
+    static bool B2F(const uint8_t* _REGS, DateTimeFields& _fields, const uint8_t _CHIP);
+    static bool F2B(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, uint8_t* _regs, const uint8_t _CHIP, const bool _USE12);
+    // Bucket - Floor To A Period & The Start Of The Next One (Local Seconds Since 01/03/0000) & The Period Number
+    uint64_t PFL(const uint64_t _LOCAL, const uint8_t _PERIOD, uint64_t& _next, int64_t& _index);
+    // Bucket & Convert - Day 1 Of A Month In Days Since 01/03/0000
+    static uint32_t DFC(const uint16_t _YEAR, const uint8_t _MONTH);
+    // Get - Nth Weekday Of Month From The Weekday Of Day 1 & The Days In Month
+    static uint8_t NWD(const int8_t _N, const uint8_t _DOW, const uint8_t _FIRST, const uint8_t _DIM);
+    // Leap Seconds - Read Table Entry, Search The Table & Fill The Cache
+    uint32_t LTE(const uint8_t _I);
+    uint8_t LTS(const int64_t _T, const bool _TAI);
+    void LTC(const uint8_t _K);
+    // Check - Valid Date & Valid Time Kernels - No Branches, No Tables
+    static bool VDT(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);
+    static bool VTM(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC);
+    // Convert - Make The Number String
+    static uint8_t U2S(char* _buffer, const uint64_t _IN);
+    // Convert - Add Two Digits (First Digit Only If _ZERO Or 10+) & Add The Year (No Leading Zeros) - Returns: Length
+    static uint8_t A2D(char* _buffer, const uint8_t _IN, const bool _ZERO);
+    static uint8_t AYR(char* _buffer, const uint16_t _YEAR);
+    // Convert - Add The Short Month Name - Returns: Length
+    static uint8_t AMN(char* _buffer, const uint8_t _MONTH);
+    // Date - Field Order Of The Date Format - 2.bits Per Field: 0 = Day & 1 = Month & 2 = Year
+    static uint8_t DFO();
+    // Print - Two Digits, A Number, The Date & The Clock - Returns: Characters Written
+    static size_t P2D(Print& _out, const uint8_t _IN, const bool _ZERO);
+    static size_t PUN(Print& _out, const uint64_t _IN);
+    size_t PDF(Print& _out, const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const bool _USEMONTHNAME);
+    size_t PCF(Print& _out, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const bool _USESEC, const bool _AMPM);
+    // Convert - Make The Roman Numerals
+    uint8_t N2R(char* _buffer, const uint16_t _IN);
     // Clock - Make The Clock String
     char* MTCS(const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC, const bool _USESEC, const bool _AMPM);
     // Date Format, Clock Format & Date Time Zero's
@@ -96,6 +420,34 @@ class DateTimeFunctions {
     static bool _CLOCKFORMAT_;    // Clock Format: ture = 24.Hours & false = 12.Hours
     static bool _USEDATEZERO_;    // Date Zero: true = 01/01/YYYY & false = 1/1/YYYY
     static bool _USEHOURZERO_;    // Hour Zero: true = 01:MM:SS & false = 1:MM:SS
+    // Leap Seconds - Loaded Table & Cached Interval
+    static const uint32_t* _LEAPRAM_; // Loaded Table: NULL = Built In Table
+    static uint8_t _LEAPCOUNT_;       // Leap Seconds In The Table
+    static bool _LEAPSMEAR_;          // Leap Smear: true = 24.hour Linear Smear & false = Step (23:59:60)
+    static int64_t _LEAPFROM_;        // Cache: Unix Time Where The Offset Starts
+    static uint64_t _LEAPSPAN_;       // Cache: Seconds Until The Next Leap Second (0 = Empty)
+    static uint8_t _LEAPINDEX_;       // Cache: Leap Seconds Before The Interval
+    #if DATETIMEFUNCTIONS_STATS                      // Instrumentation
+    // Stats
+    static const char STATNAMES[];                   // Counted Function Names
+    static DateTimeFunctionsStats __stats;           // Calls & Cycles
+    // Stats - Read The Cycle Counter - 32.bit On Arduino, The Difference Is Right Across A Wrap
+    #if defined(ARDUINO)                             // Arduino Build
+    typedef uint32_t CCT;                            // Cycle Counter Type
+    #else                                            // Host Build
+    typedef uint64_t CCT;                            // Cycle Counter Type
+    #endif
+    static CCT RCC();
+    // Stats - Make The Stats Line - Returns: String Length
+    static uint8_t MSL(char* _buffer, const uint8_t _ID);
+    // Stats - Count One Call From Start To End Of Scope
+    struct SS {
+      const uint8_t _id;                             // Function Index
+      const CCT _START;                              // Cycles At Start
+      SS(const uint8_t _ID) : _id(_ID), _START(RCC()) {}
+      ~SS() { __stats.calls[_id]++; __stats.cycles[_id] += (DateTimeFunctionsTicks)(RCC() - _START); }
+    };
+    #endif
 };
 
 // End Of File.
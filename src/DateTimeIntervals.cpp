@@ -0,0 +1,230 @@
+//
+//    FILE: DateTimeIntervals.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Time interval sets for DateTimeFunctions. Opening hours, maintenance windows & the like.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+#include "DateTimeIntervals.h"                    // Include The DateTimeIntervals Header
+
+// How it works:
+// A set is a sorted list of intervals [start, end) that do not overlap or touch - add() merges the
+// new interval with its neighbours, so the list is always kept that way. Because the starts and the
+// ends are both sorted, contains() & nextTransition() are a binary search. Union, intersection &
+// difference walk the edges of both sets once, in time order, and write an edge each time the result
+// changes between in & out. A set with a period (minute of week or second of day) wraps: an interval
+// that crosses the end of the period is kept as two, one at the end & one from 0.
+
+
+//---------------------- Set ----------------------//
+
+// Set The Class Object Name - DateTimeIntervals(period) - Period: 0 = None, DATETIMEINTERVALS_WEEK Or DATETIMEINTERVALS_DAY
+DateTimeIntervals::DateTimeIntervals(const uint32_t _PERIOD) {
+  _count  = 0;                                    // No Intervals
+  _period = _PERIOD;                              // Set The Period
+}
+
+// Remove All Intervals - clear()
+void DateTimeIntervals::clear() {
+  _count = 0;                                     // No Intervals
+}
+
+// Add An Interval - add(start, end) = Returns: true If Added "0-1"
+bool DateTimeIntervals::add(const uint32_t _START, const uint32_t _END) {
+  // _START Up To, Not With, _END. With a period, an _END before _START or past the period wraps to 0.
+  if (_period && (_START >= _period || _END > _period * 2UL)) return false; // Not In The Period
+  if (_period && (_END < _START || _END > _period)) {                       // Wraps
+    const bool _OK = ADI(_START, _period);                                  // Up To The End Of The Period
+    return ADI(0, (_END < _START) ? _END : _END - _period) && _OK;          // From 0
+  }
+  return ADI(_START, _END);                                                 // Add The Interval
+}
+
+// Add Minute Of Week Intervals - addWeekly(mask, hour1, min1, hour2, min2) = Returns: true If Added "0-1"
+bool DateTimeIntervals::addWeekly(const uint8_t _DOWMASK, const uint8_t _HOUR1, const uint8_t _MIN1, const uint8_t _HOUR2, const uint8_t _MIN2) {
+  // Mon-Fri 08:00-17:30 = addWeekly(0x3E, 8, 0, 17, 30). An end at or before the start goes on past
+  // midnight into the next day (22:00-06:00), and Saturday night goes on into Sunday morning.
+  const uint16_t _START = _dTF.getMFM(_HOUR1, _MIN1);                       // Start - Minutes From Midnight
+  uint16_t _end = _dTF.getMFM(_HOUR2, _MIN2);                               // End - Minutes From Midnight
+  if (_end <= _START) _end += 1440U;                                        // Past Midnight
+  bool _ok = true;                                                          // All Added
+  for (uint8_t _dow = 0; _dow < 7; _dow++) {
+    if (!((_DOWMASK >> _dow) & 1U)) continue;                               // Not This Day
+    const uint32_t _S = _dow * 1440UL + _START;                             // Start - Minute Of Week
+    const uint32_t _E = _dow * 1440UL + _end;                               // End - Minute Of Week
+    if (_E > DATETIMEINTERVALS_WEEK) {                                      // Past The End Of The Week
+      if (!ADI(_S, DATETIMEINTERVALS_WEEK)) _ok = false;                    // Saturday
+      if (!ADI(0, _E - DATETIMEINTERVALS_WEEK)) _ok = false;                // Sunday
+    }
+    else if (!ADI(_S, _E)) _ok = false;                                     // Add The Interval
+  }
+  return _ok;
+}
+
+// Add A Second Of Day Interval - addDaily(hour1, min1, sec1, hour2, min2, sec2) = Returns: true If Added "0-1"
+bool DateTimeIntervals::addDaily(const uint8_t _HOUR1, const uint8_t _MIN1, const uint8_t _SEC1, const uint8_t _HOUR2, const uint8_t _MIN2, const uint8_t _SEC2) {
+  // For sets with DATETIMEINTERVALS_DAY. An end at or before the start goes on past midnight.
+  const uint32_t _START = _dTF.getSFM(_HOUR1, _MIN1, _SEC1);                // Start - Seconds From Midnight
+  const uint32_t _END = _dTF.getSFM(_HOUR2, _MIN2, _SEC2);                  // End - Seconds From Midnight
+  if (_END > _START) return ADI(_START, _END);                              // The Same Day
+  const bool _OK = ADI(_START, DATETIMEINTERVALS_DAY);                      // Up To Midnight
+  return ADI(0, _END) && _OK;                                               // From Midnight
+}
+
+
+//------------------ Set Algebra ------------------//
+
+// Set To _A Or _B - setUnion(a, b) = Returns: false If The Result Did Not Fit
+bool DateTimeIntervals::setUnion(const DateTimeIntervals& _A, const DateTimeIntervals& _B) {
+  return MRG(_A, _B, 0);                                                    // Merge - Or
+}
+
+// Set To _A And _B - setIntersection(a, b) = Returns: false If The Result Did Not Fit
+bool DateTimeIntervals::setIntersection(const DateTimeIntervals& _A, const DateTimeIntervals& _B) {
+  return MRG(_A, _B, 1);                                                    // Merge - And
+}
+
+// Set To _A And Not _B - setDifference(a, b) = Returns: false If The Result Did Not Fit
+bool DateTimeIntervals::setDifference(const DateTimeIntervals& _A, const DateTimeIntervals& _B) {
+  return MRG(_A, _B, 2);                                                    // Merge - And Not
+}
+
+
+//--------------------- Check ---------------------//
+
+// Check For Time In The Set - contains(time) = Returns: true If In The Set "0-1"
+bool DateTimeIntervals::contains(const uint32_t _TIME) {
+  const uint32_t _T = _period ? _TIME % _period : _TIME;                    // Time In The Period
+  const uint16_t _K = FND(_T);                                              // Last Interval Starting At Or Before
+  return _K && _T < _spans[_K - 1]._end;                                    // Return In The Interval
+}
+
+
+//---------------------- Get ----------------------//
+
+// Get The Next Time The Set Is Entered Or Left - nextTransition(time, next) = Returns: false If None
+bool DateTimeIntervals::nextTransition(const uint32_t _TIME, uint32_t& _next) {
+  // With a period, _next is _TIME plus the minutes or seconds to the transition, so it can be past the period.
+  if (_count == 0) return false;                                            // Empty - Never Changes
+  const uint32_t _T = _period ? _TIME % _period : _TIME;                    // Time In The Period
+  const uint16_t _K = FND(_T);                                              // Last Interval Starting At Or Before
+  uint32_t _edge;                                                           // Next Edge
+  if (_K && _T < _spans[_K - 1]._end) {                                     // In - Left At The End
+    _edge = _spans[_K - 1]._end;                                            // End Of This Interval
+    if (_period && _edge == _period && _spans[0]._start == 0) {             // Left At The End Of The Period, But In Again At 0
+      if (_spans[0]._end == _period) return false;                          // The Whole Period - Never Changes
+      _edge = _spans[0]._end + _period;                                     // Left In The Next Period
+    }
+  }
+  else if (_K < _count) _edge = _spans[_K]._start;                          // Out - Entered At The Next Start
+  else if (_period) _edge = _spans[0]._start + _period;                     // Out - Entered In The Next Period
+  else return false;                                                        // Out - Never Entered Again
+  _next = _TIME + (_edge - _T);                                             // Set The Next Transition
+  return true;
+}
+
+// Get The Intervals In The Set - getCount() = Returns: 0 ... DATETIMEINTERVALS_MAX
+uint16_t DateTimeIntervals::getCount() {
+  return _count;                                                            // Return The Intervals
+}
+
+// Get Interval i - getInterval(i, start, end) = Returns: false If No Interval i
+bool DateTimeIntervals::getInterval(const uint16_t _I, uint32_t& _start, uint32_t& _end) {
+  if (_I >= _count) return false;                                           // No Interval
+  _start = _spans[_I]._start;                                               // Set The Start
+  _end = _spans[_I]._end;                                                   // Set The End
+  return true;
+}
+
+// Get Minute Of Week - getMOW(dow, hour, min) = Returns: 0-10079 "Sunday 00:00 = 0"
+uint16_t DateTimeIntervals::getMOW(const uint8_t _DOW, const uint8_t _HOUR, const uint8_t _MIN) {
+  return _DOW * 1440U + _dTF.getMFM(_HOUR, _MIN);                           // Return The Minute Of Week
+}
+
+// Get Minute Of Week From Unix Time - getMOW(unixTime, offset) = Returns: 0-10079 "Sunday 00:00 = 0"
+uint16_t DateTimeIntervals::getMOW(const uint64_t _UNIXTIME, const int32_t _OFFSET) {
+  // _OFFSET Is The Time Zone In Seconds (+3600 = UTC+1). 01/01/1970 Was A Thursday.
+  const uint64_t _LOCAL = _UNIXTIME + (int64_t)_OFFSET + 7ULL * 86400ULL;   // Local Seconds - One Week On, So Never Negative
+  const uint32_t _DAYS = (uint32_t)(_LOCAL / 86400ULL);                     // Days
+  const uint32_t _SOD = (uint32_t)(_LOCAL - (uint64_t)_DAYS * 86400ULL);    // Seconds In The Day
+  return getMOW((_DAYS + 4UL) % 7UL, _SOD / 3600UL, (_SOD / 60UL) % 60UL);  // Return The Minute Of Week
+}
+
+
+//-------------------- Private --------------------//
+
+// Add An Interval That Does Not Wrap - Merges With The Intervals It Overlaps Or Touches
+bool DateTimeIntervals::ADI(const uint32_t _START, const uint32_t _END) {
+  if (_END <= _START) return true;                                          // Empty - Nothing To Add
+  // First Interval That Ends At Or After _START - Binary Search
+  uint16_t _low = 0, _high = _count;                                        // Search _low ... _high
+  while (_low < _high) {
+    const uint16_t _MID = (_low + _high) >> 1;                              // Middle Interval
+    if (_spans[_MID]._end < _START) _low = _MID + 1;                        // Search The Later Half
+    else _high = _MID;                                                      // Search The Earlier Half
+  }
+  const uint16_t _I = _low;                                                 // First Interval To Merge
+  const uint16_t _J = FND(_END);                                            // Intervals Starting At Or Before _END
+  if (_I >= _J) {                                                           // No Overlap - Insert At _I
+    if (_count >= DATETIMEINTERVALS_MAX) return false;                      // Full
+    for (uint16_t _k = _count; _k > _I; _k--) _spans[_k] = _spans[_k - 1];  // Move Up
+    _spans[_I]._start = _START;                                             // Set The Start
+    _spans[_I]._end = _END;                                                 // Set The End
+    _count++;                                                               // One More
+    return true;
+  }
+  // Merge _I ... _J - 1 Into _I
+  if (_START < _spans[_I]._start) _spans[_I]._start = _START;               // Earlier Start
+  _spans[_I]._end = (_END > _spans[_J - 1]._end) ? _END : _spans[_J - 1]._end; // Later End
+  const uint16_t _GONE = _J - 1 - _I;                                       // Intervals Merged Away
+  for (uint16_t _k = _J; _k < _count; _k++) _spans[_k - _GONE] = _spans[_k]; // Move Down
+  _count -= _GONE;                                                          // Less Intervals
+  return true;
+}
+
+// Merge Two Sets - _OP: 0 = Or & 1 = And & 2 = And Not - Returns: false If The Result Did Not Fit
+bool DateTimeIntervals::MRG(const DateTimeIntervals& _A, const DateTimeIntervals& _B, const uint8_t _OP) {
+  // Edge k of a set is the start (k even) or the end (k odd) of interval k / 2, so after edge k
+  // the time is in the set when k is even. Both sets are walked once, edges in time order.
+  Span _out[DATETIMEINTERVALS_MAX];                                         // Result - Kept Apart, So The Set Can Be _A Or _B
+  uint16_t _n = 0;                                                          // Intervals In The Result
+  bool _ok = true;                                                          // Result Fits
+  bool _in = false;                                                         // In The Result
+  uint32_t _start = 0;                                                      // Start Of The Result Interval
+  const uint16_t _NA = _A._count * 2U, _NB = _B._count * 2U;                // Edges In Each Set
+  uint16_t _ia = 0, _ib = 0;                                                // Next Edge In Each Set
+  while (_ia < _NA || _ib < _NB) {
+    const uint32_t _EA = (_ia < _NA) ? ((_ia & 1U) ? _A._spans[_ia >> 1]._end : _A._spans[_ia >> 1]._start) : 0; // Next Edge Of _A
+    const uint32_t _EB = (_ib < _NB) ? ((_ib & 1U) ? _B._spans[_ib >> 1]._end : _B._spans[_ib >> 1]._start) : 0; // Next Edge Of _B
+    const uint32_t _EDGE = (_ia >= _NA) ? _EB : (_ib >= _NB) ? _EA : (_EA < _EB ? _EA : _EB); // Earliest Edge
+    if (_ia < _NA && _EA == _EDGE) _ia++;                                   // Past The Edge Of _A
+    if (_ib < _NB && _EB == _EDGE) _ib++;                                   // Past The Edge Of _B
+    const bool _INA = _ia & 1U, _INB = _ib & 1U;                            // In _A & In _B
+    const bool _IN = (_OP == 0) ? (_INA || _INB) : (_OP == 1) ? (_INA && _INB) : (_INA && !_INB); // In The Result
+    if (_IN == _in) continue;                                               // No Change
+    _in = _IN;                                                              // Set In
+    if (_IN) _start = _EDGE;                                                // Result Interval Starts
+    else if (_n < DATETIMEINTERVALS_MAX) { _out[_n]._start = _start; _out[_n]._end = _EDGE; _n++; } // Result Interval Ends
+    else _ok = false;                                                       // Full
+  }
+  for (uint16_t _k = 0; _k < _n; _k++) _spans[_k] = _out[_k];               // Set The Result
+  _count = _n;                                                              // Set The Intervals
+  return _ok;
+}
+
+// Last Interval That Starts At Or Before A Time - Returns: Index + 1, 0 = None
+uint16_t DateTimeIntervals::FND(const uint32_t _TIME) {
+  uint16_t _low = 0, _high = _count;                                        // Search _low ... _high
+  while (_low < _high) {
+    const uint16_t _MID = (_low + _high) >> 1;                              // Middle Interval
+    if (_spans[_MID]._start <= _TIME) _low = _MID + 1;                      // Search The Later Half
+    else _high = _MID;                                                      // Search The Earlier Half
+  }
+  return _low;                                                              // Return Intervals Starting At Or Before
+}
+
+// End Of File.
@@ -0,0 +1,58 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeIntervals.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Time interval sets for DateTimeFunctions. Opening hours, maintenance windows & the like.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// Include
+#include "DateTimeFunctions.h"                       // Include The DateTimeFunctions Library
+
+// Settings
+#define DATETIMEINTERVALS_MAX  16                    // Max Intervals In A Set - 8.bytes Each
+#define DATETIMEINTERVALS_WEEK 10080UL               // Period: Minute Of Week - 7 * 1440 (Sunday 00:00 = 0)
+#define DATETIMEINTERVALS_DAY  86400UL               // Period: Second Of Day
+
+
+class DateTimeIntervals {
+  public:                                            // Public
+    // Set
+    DateTimeIntervals(const uint32_t _PERIOD = 0);                                                                      // Set The Class Object Name - Period: 0 = None (Unix Seconds), _WEEK Or _DAY
+    void clear();                                                                                                       // Remove All Intervals
+    bool add(const uint32_t _START, const uint32_t _END);                                                               // Add An Interval - _START Up To, Not With, _END
+    bool addWeekly(const uint8_t _DOWMASK, const uint8_t _HOUR1, const uint8_t _MIN1, const uint8_t _HOUR2, const uint8_t _MIN2); // Add Minute Of Week Intervals - Bit 0 = Sunday ... Bit 6 = Saturday
+    bool addDaily(const uint8_t _HOUR1, const uint8_t _MIN1, const uint8_t _SEC1, const uint8_t _HOUR2, const uint8_t _MIN2, const uint8_t _SEC2); // Add A Second Of Day Interval
+    // Set Algebra - Linear Merge, The Set Can Be _A Or _B
+    bool setUnion(const DateTimeIntervals& _A, const DateTimeIntervals& _B);                                            // Set To _A Or _B
+    bool setIntersection(const DateTimeIntervals& _A, const DateTimeIntervals& _B);                                     // Set To _A And _B
+    bool setDifference(const DateTimeIntervals& _A, const DateTimeIntervals& _B);                                       // Set To _A And Not _B
+    // Check
+    bool contains(const uint32_t _TIME);                                                                                // Check For Time In The Set
+    // Get
+    bool nextTransition(const uint32_t _TIME, uint32_t& _next);                                                         // Get The Next Time The Set Is Entered Or Left
+    uint16_t getCount();                                                                                                // Get The Intervals In The Set
+    bool getInterval(const uint16_t _I, uint32_t& _start, uint32_t& _end);                                              // Get Interval i
+    uint16_t getMOW(const uint8_t _DOW, const uint8_t _HOUR, const uint8_t _MIN);                                       // Get Minute Of Week
+    uint16_t getMOW(const uint64_t _UNIXTIME, const int32_t _OFFSET = 0);                                               // Get Minute Of Week From Unix Time
+
+  private:                                           // Private
+    // Interval - _start Up To, Not With, _end
+    struct Span {
+      uint32_t _start;                               // Start
+      uint32_t _end;                                 // End
+    };
+    Span _spans[DATETIMEINTERVALS_MAX];              // Intervals - Sorted, Not Touching
+    uint16_t _count;                                 // Intervals In The Set
+    uint32_t _period;                                // Period - 0 = None
+    DateTimeFunctions _dTF;                          // Date Functions
+    // Add An Interval That Does Not Wrap
+    bool ADI(const uint32_t _START, const uint32_t _END);
+    // Merge Two Sets - _OP: 0 = Or & 1 = And & 2 = And Not
+    bool MRG(const DateTimeIntervals& _A, const DateTimeIntervals& _B, const uint8_t _OP);
+    // Last Interval That Starts At Or Before A Time - Returns: Index + 1, 0 = None
+    uint16_t FND(const uint32_t _TIME);
+};
+
+// End Of File.
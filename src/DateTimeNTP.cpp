@@ -0,0 +1,220 @@
+//
+//    FILE: DateTimeNTP.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Non blocking NTP client for DateTimeFunctions. Sets a DateTimeClock from loop() without stalling it.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+#include "DateTimeNTP.h"                          // Include The DateTimeNTP Header
+#if !defined(ARDUINO)                             // Host Build
+  #include <arpa/inet.h>                          // inet_pton()
+  #include <fcntl.h>                              // fcntl()
+  #include <sys/socket.h>                         // socket()
+  #include <unistd.h>                             // close()
+#endif
+
+// How it works:
+// poll() does one step and returns: send a request, look for the reply, give up on it after
+// DATETIMENTP_TIMEOUT, and after the last request set the clock. Nothing waits, so loop() keeps going.
+// The local time is the tick source from the start of the sync, as 32.32 fixed point seconds like the
+// NTP timestamps. The request carries its send time T1, the reply carries it back with the server
+// receive time T2 & send time T3, and T4 is the tick time the reply was seen:
+//   offset = ((T2 - T1) + (T3 - T4)) / 2   delay = (T4 - T1) - (T3 - T2)
+// T2 & T3 are taken relative to the whole second of T2, so all of it is 64.bit integer math.
+// Out of DATETIMENTP_SAMPLES requests the reply with the least delay is used, as it has the least
+// room for an uneven path. A reply is only taken if it carries our T1 back, is from a server
+// (mode 4) with a stratum of 1-15 & a set clock. The clock is set with DateTimeClock::sync(),
+// which also measures the drift of the tick source.
+
+// Local Time 0 Is 1.sec After The Start, So T1 Is Never 0
+#define DATETIMENTP_LOCAL_START 1000UL            // Milliseconds
+
+
+//---------------------- Set ----------------------//
+
+// Set The Transport, The Clock To Set & A Millisecond Tick Source - DateTimeNTP(ntpUdp, clk, millis)
+DateTimeNTP::DateTimeNTP(DateTimeNTPTransport& _UDP, DateTimeClock& _CLOCK, uint32_t (*_MILLIS)()) : _udp(_UDP), _clock(_CLOCK) {
+  _millis = _MILLIS;                              // Tick Source
+  _state = 0;                                     // Idle
+  _samples = 0;                                   // Not Started
+  _sent = 0;                                      // Nothing Sent
+  _base = 0UL; _sentAt = 0UL; _doneAt = 0UL;      // Tick Times
+  _interval = 0UL;                                // No Interval
+  _t1 = 0ULL;                                     // No Request
+  _bestOffset = 0LL;                              // No Sample
+  _bestDelay = 0xFFFFFFFFUL;                      // No Sample
+  _bestStratum = 0;                               // No Sample
+  _offset = 0L; _delay = 0UL; _stratum = 0;       // No Sync
+}
+
+// Start A Sync - start(samples) - poll() Does The Rest
+void DateTimeNTP::start(const uint8_t _SAMPLES) {
+  _samples = _SAMPLES ? _SAMPLES : 1;             // Requests In This Sync
+  _sent = 0;                                      // Nothing Sent
+  _base = _millis();                              // Local Time 0
+  _bestDelay = 0xFFFFFFFFUL;                      // No Sample
+  _state = 1;                                     // Send
+}
+
+// Sync Again Every _SECONDS After A Sync - setInterval(3600) - 0 = Off
+void DateTimeNTP::setInterval(const uint32_t _SECONDS) {
+  _interval = _SECONDS * 1000UL;                  // Milliseconds - Up To 49.days
+}
+
+
+//---------------------- Run ----------------------//
+
+// Do The Next Step - poll() = Returns: DATETIMENTP_IDLE, _BUSY, _SYNCED Or _FAILED "Events Come Once"
+uint8_t DateTimeNTP::poll() {
+  const uint32_t _NOW = _millis();                                          // Ticks Now
+  if (_state == 0) {                                                        // Idle
+    if (!_interval || !_samples || (uint32_t)(_NOW - _doneAt) < _interval) return DATETIMENTP_IDLE; // Not Yet
+    start(_samples);                                                        // Time For The Next Sync
+  }
+  if (_state == 1) {                                                        // Send
+    if (_sent > 0 && (uint32_t)(_NOW - _sentAt) < DATETIMENTP_GAP) return DATETIMENTP_BUSY; // Not Too Fast
+    uint8_t _packet[DATETIMENTP_PACKET];                                    // Request
+    memset(_packet, 0, sizeof(_packet));                                    // Clear It
+    _packet[0] = 0x23;                                                      // LI = 0, Version = 4, Mode = 3 (Client)
+    _t1 = LFP(_NOW);                                                        // T1 - Local Send Time
+    for (uint8_t _i = 0; _i < 8; _i++) _packet[40 + _i] = (uint8_t)(_t1 >> (56 - 8 * _i)); // Transmit Timestamp - Comes Back As The Originate Timestamp
+    _sent++;                                                                // One More Request
+    _sentAt = _NOW;                                                         // Send Time
+    if (!_udp.send(_packet, sizeof(_packet))) return (_sent >= _samples) ? END() : DATETIMENTP_BUSY; // Not Sent - Next Request
+    _state = 2;                                                             // Wait For The Reply
+    return DATETIMENTP_BUSY;
+  }
+  // Wait
+  uint8_t _packet[DATETIMENTP_PACKET];                                      // Reply
+  const int16_t _LEN = _udp.receive(_packet, sizeof(_packet));              // Look For The Reply
+  const bool _GOOD = (_LEN > 0) && PRS(_packet, _LEN, _millis());           // T4 Is Taken Right After The Reply Was Read
+  if (_GOOD || (uint32_t)(_NOW - _sentAt) >= DATETIMENTP_TIMEOUT) {         // Reply Or Time Out
+    _state = 1;                                                             // Next Request
+    if (_sent >= _samples) return END();                                    // Last Request - Set The Clock
+  }
+  return DATETIMENTP_BUSY;
+}
+
+
+//---------------------- Get ----------------------//
+
+// Get The Clock Error Fixed By The Last Sync - getOffset() = Returns: Milliseconds, + = The Clock Was Behind, 0 On The First Sync
+int32_t DateTimeNTP::getOffset() {
+  return _offset;                                                           // Return The Offset
+}
+
+// Get The Round Trip Delay Of The Last Sync - getDelay() = Returns: Microseconds
+uint32_t DateTimeNTP::getDelay() {
+  return _delay;                                                            // Return The Delay
+}
+
+// Get The Server Stratum Of The Last Sync - getStratum() = Returns: 1-15, 0 = No Sync Yet
+uint8_t DateTimeNTP::getStratum() {
+  return _stratum;                                                          // Return The Stratum
+}
+
+
+//-------------------- Private --------------------//
+
+// Local Time As 32.32 Fixed Point Seconds Since The Start Of The Sync
+uint64_t DateTimeNTP::LFP(const uint32_t _TICKS) {
+  const uint32_t _MS = _TICKS - _base + DATETIMENTP_LOCAL_START;            // Local Milliseconds
+  const uint32_t _SEC = _MS / 1000UL;                                       // Seconds
+  return ((uint64_t)_SEC << 32) | _dTF.conMicros2NTPFrac((_MS - _SEC * 1000UL) * 1000UL); // Seconds & Fraction
+}
+
+// Read A 32.32 Timestamp From The Packet - Big Endian
+uint64_t DateTimeNTP::RFP(const uint8_t* _P) {
+  uint64_t _t = 0ULL;                                                       // Timestamp
+  for (uint8_t _i = 0; _i < 8; _i++) _t = (_t << 8) | _P[_i];              // Add The Byte
+  return _t;
+}
+
+// Parse A Reply - Returns: true If It Is A Good Reply To The Last Request "0-1"
+bool DateTimeNTP::PRS(const uint8_t* _PACKET, const int16_t _LEN, const uint32_t _TICKS) {
+  if (_LEN < DATETIMENTP_PACKET) return false;                              // Too Short
+  if ((_PACKET[0] & 0x07U) != 4U || (_PACKET[0] >> 6) == 3U) return false;  // Not A Server Or Clock Not Set
+  if (_PACKET[1] == 0U || _PACKET[1] > 15U) return false;                   // Kiss-o'-Death Or Not Synced
+  if (RFP(_PACKET + 24) != _t1) return false;                               // Not A Reply To The Last Request
+  const uint64_t _T2 = RFP(_PACKET + 32), _T3 = RFP(_PACKET + 40);          // Server Receive & Send Time - NTP Era
+  if (_T2 == 0ULL || _T3 == 0ULL) return false;                             // No Time
+  const uint64_t _T4 = LFP(_TICKS);                                         // Local Receive Time
+  // Server Times Relative To The Whole Second Of T2 - Small, So The Sums Fit In 64.bits
+  const int64_t _S = _dTF.conNTP2UT((uint32_t)(_T2 >> 32));                 // Unix Second Of T2
+  const int64_t _A = (int64_t)(_T2 & 0xFFFFFFFFULL);                        // T2 - S
+  const int64_t _B = ((_dTF.conNTP2UT((uint32_t)(_T3 >> 32)) - _S) << 32) + (int64_t)(_T3 & 0xFFFFFFFFULL); // T3 - S
+  const int64_t _REL = ((_A - (int64_t)_t1) + (_B - (int64_t)_T4)) >> 1;    // Offset - S, 32.32 Fixed Point
+  int64_t _d = ((int64_t)_T4 - (int64_t)_t1) - (_B - _A);                   // Delay, 32.32 Fixed Point
+  if (_d < 0) _d = 0;                                                       // Server Clock Steps Can Make It Less Than 0
+  // To Milliseconds & Microseconds - Whole Seconds & Fraction Apart, No Overflow
+  const int64_t _OFFSETMS = _S * 1000LL + (_REL >> 32) * 1000LL + (int64_t)(((_REL & 0xFFFFFFFFLL) * 1000LL) >> 32); // Unix ms At Local ms 0
+  const uint64_t _DUS = (uint64_t)(_d >> 32) * 1000000ULL + (((uint64_t)_d & 0xFFFFFFFFULL) * 1000000ULL >> 32); // Delay In Microseconds
+  const uint32_t _DELAY = (_DUS > 0xFFFFFFFEULL) ? 0xFFFFFFFEUL : (uint32_t)_DUS; // Limit
+  if (_DELAY < _bestDelay) {                                                // Least Delay So Far
+    _bestDelay = _DELAY;                                                    // Keep The Sample
+    _bestOffset = _OFFSETMS;
+    _bestStratum = _PACKET[1];
+  }
+  return true;
+}
+
+// End The Sync - Set The Clock From The Best Sample - Returns: DATETIMENTP_SYNCED Or _FAILED
+uint8_t DateTimeNTP::END() {
+  _state = 0;                                                               // Idle
+  const uint32_t _NOW = _millis();                                          // Ticks Now
+  _doneAt = _NOW;                                                           // For The Interval
+  if (_bestDelay == 0xFFFFFFFFUL) return DATETIMENTP_FAILED;                // No Good Reply
+  const uint64_t _UNIXMS = (uint64_t)(_bestOffset + (int64_t)(uint32_t)(_NOW - _base + DATETIMENTP_LOCAL_START)); // Unix Milliseconds Now
+  int64_t _err = _clock.isSynced() ? (int64_t)(_UNIXMS - _clock.nowMillis()) : 0LL; // Clock Error
+  if (_err > 2147483647LL) _err = 2147483647LL;                             // Limit
+  if (_err < -2147483647LL) _err = -2147483647LL;
+  _clock.sync((uint32_t)(_UNIXMS / 1000ULL), (uint16_t)(_UNIXMS % 1000ULL)); // Set The Clock
+  _offset = (int32_t)_err;                                                  // Last Sync
+  _delay = _bestDelay;
+  _stratum = _bestStratum;
+  return DATETIMENTP_SYNCED;
+}
+
+
+//------------------ Host Transport ---------------//
+
+#if !defined(ARDUINO)                                                       // Host Build
+// Set The Server - DateTimeNTPHostUDP("127.0.0.1", 12300) - Non Blocking, Only Takes Packets From The Server
+DateTimeNTPHostUDP::DateTimeNTPHostUDP(const char* _IP, const uint16_t _PORT) {
+  _fd = socket(AF_INET, SOCK_DGRAM, 0);                                     // UDP Socket
+  if (_fd < 0) return;                                                      // No Socket
+  struct sockaddr_in _addr;                                                 // Server Address
+  memset(&_addr, 0, sizeof(_addr));                                         // Clear It
+  _addr.sin_family = AF_INET;                                               // IPv4
+  _addr.sin_port = htons(_PORT);                                            // Port
+  if (inet_pton(AF_INET, _IP, &_addr.sin_addr) != 1 ||                      // Not An Address
+      connect(_fd, (struct sockaddr*)&_addr, sizeof(_addr)) != 0 ||         // Set The Peer
+      fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL, 0) | O_NONBLOCK) != 0) {      // Do Not Block
+    close(_fd);                                                             // Close It
+    _fd = -1;                                                               // Not Open
+  }
+}
+
+// Close The Socket
+DateTimeNTPHostUDP::~DateTimeNTPHostUDP() {
+  if (_fd >= 0) close(_fd);                                                 // Close The Socket
+}
+
+// Send A Packet To The Server - Returns: false If Not Sent
+bool DateTimeNTPHostUDP::send(const uint8_t* _DATA, const uint8_t _LEN) {
+  return _fd >= 0 && ::send(_fd, _DATA, _LEN, 0) == (ssize_t)_LEN;          // Send It
+}
+
+// Get A Packet If There Is One - Returns: Bytes, 0 = None
+int16_t DateTimeNTPHostUDP::receive(uint8_t* _data, const uint8_t _MAX) {
+  if (_fd < 0) return 0;                                                    // Not Open
+  const ssize_t _N = recv(_fd, _data, _MAX, 0);                             // Read A Packet - Non Blocking
+  return (_N > 0) ? (int16_t)_N : 0;                                        // Bytes Or None
+}
+#endif
+
+// End Of File.
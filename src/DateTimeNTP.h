@@ -0,0 +1,113 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeNTP.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Non blocking NTP client for DateTimeFunctions. Sets a DateTimeClock from loop() without stalling it.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// Include
+#include "DateTimeClock.h"                           // Include The DateTimeClock Library
+
+// Settings
+#define DATETIMENTP_PACKET   48                      // NTP Packet Size
+#define DATETIMENTP_SAMPLES  4                       // Requests Per Sync - The One With The Least Delay Is Used
+#ifndef DATETIMENTP_TIMEOUT
+  #define DATETIMENTP_TIMEOUT 1000UL                 // Milliseconds To Wait For A Reply
+#endif
+#ifndef DATETIMENTP_GAP
+  #define DATETIMENTP_GAP     2000UL                 // Milliseconds Between Requests - Public Servers Limit The Rate
+#endif
+
+// States & Events From poll()
+#define DATETIMENTP_IDLE     0                       // Nothing To Do
+#define DATETIMENTP_BUSY     1                       // Sync Going On
+#define DATETIMENTP_SYNCED   2                       // Event: The Clock Was Just Set
+#define DATETIMENTP_FAILED   3                       // Event: No Good Reply
+
+
+// UDP Transport - Both Calls Must Return Right Away
+class DateTimeNTPTransport {
+  public:                                            // Public
+    virtual ~DateTimeNTPTransport() {}
+    virtual bool send(const uint8_t* _DATA, const uint8_t _LEN) = 0;                                                   // Send A Packet To The Server - Returns: false If Not Sent
+    virtual int16_t receive(uint8_t* _data, const uint8_t _MAX) = 0;                                                    // Get A Packet If There Is One - Returns: Bytes, 0 = None
+};
+
+// UDP Transport - Any Arduino UDP Class (WiFiUDP, EthernetUDP ...): DateTimeNTPUdp<WiFiUDP> ntpUdp(udp, "pool.ntp.org");
+template <class UDP> class DateTimeNTPUdp : public DateTimeNTPTransport {
+  public:                                            // Public
+    DateTimeNTPUdp(UDP& _udp, const char* _HOST, const uint16_t _PORT = 123) : _socket(_udp), _host(_HOST), _port(_PORT) {} // Call udp.begin(localPort) First
+    bool send(const uint8_t* _DATA, const uint8_t _LEN) {
+      if (!_socket.beginPacket(_host, _port)) return false;                                       // No Route
+      _socket.write(_DATA, _LEN);                                                                 // Add The Packet
+      return _socket.endPacket();                                                                 // Send It
+    }
+    int16_t receive(uint8_t* _data, const uint8_t _MAX) {
+      if (_socket.parsePacket() <= 0) return 0;                                                   // No Packet
+      return _socket.read(_data, _MAX);                                                           // Read The Packet
+    }
+  private:                                           // Private
+    UDP& _socket;                                    // The UDP Socket
+    const char* _host;                               // Server Name Or IP
+    uint16_t _port;                                  // Server Port
+};
+
+#if !defined(ARDUINO)                                // Host Build
+// UDP Transport - POSIX Socket, For Tests Against extras/DateTimeNTPServer: DateTimeNTPHostUDP ntpUdp("127.0.0.1", 12300);
+class DateTimeNTPHostUDP : public DateTimeNTPTransport {
+  public:                                            // Public
+    DateTimeNTPHostUDP(const char* _IP, const uint16_t _PORT = 123);                                                    // Set The Server - IPv4 Address
+    ~DateTimeNTPHostUDP();                                                                                              // Close The Socket
+    bool send(const uint8_t* _DATA, const uint8_t _LEN);                                                                // Send A Packet To The Server
+    int16_t receive(uint8_t* _data, const uint8_t _MAX);                                                                // Get A Packet If There Is One
+  private:                                           // Private
+    int _fd;                                         // Socket - -1 = Not Open
+};
+#endif
+
+
+class DateTimeNTP {
+  public:                                            // Public
+    // Set
+    DateTimeNTP(DateTimeNTPTransport& _udp, DateTimeClock& _clock, uint32_t (*_MILLIS)());                              // Set The Transport, The Clock To Set & A Millisecond Tick Source
+    void start(const uint8_t _SAMPLES = DATETIMENTP_SAMPLES);                                                           // Start A Sync
+    void setInterval(const uint32_t _SECONDS);                                                                          // Sync Again Every _SECONDS After A Sync - 0 = Off
+    // Run - Call From loop()
+    uint8_t poll();                                                                                                     // Do The Next Step - Returns: DATETIMENTP_IDLE, _BUSY, _SYNCED Or _FAILED
+    // Get
+    int32_t getOffset();                                                                                                // Get The Clock Error Fixed By The Last Sync - Milliseconds
+    uint32_t getDelay();                                                                                                // Get The Round Trip Delay Of The Last Sync - Microseconds
+    uint8_t getStratum();                                                                                               // Get The Server Stratum Of The Last Sync
+
+  private:                                           // Private
+    DateTimeNTPTransport& _udp;                      // The Transport
+    DateTimeClock& _clock;                           // The Clock To Set
+    uint32_t (*_millis)();                           // Millisecond Tick Source
+    DateTimeFunctions _dTF;                          // Date Functions
+    uint8_t _state;                                  // 0 = Idle, 1 = Send & 2 = Wait
+    uint8_t _samples;                                // Requests In This Sync
+    uint8_t _sent;                                   // Requests Sent
+    uint32_t _base;                                  // Ticks At The Start Of The Sync - Local Time 0
+    uint32_t _sentAt;                                // Ticks When The Last Request Was Sent
+    uint32_t _doneAt;                                // Ticks When The Last Sync Ended
+    uint32_t _interval;                              // Sync Interval - Milliseconds, 0 = Off
+    uint64_t _t1;                                    // Transmit Time Of The Request - Local 32.32 Fixed Point, Also The Nonce
+    int64_t _bestOffset;                             // Best Sample - Unix Milliseconds At Local Time 0
+    uint32_t _bestDelay;                             // Best Sample - Delay In Microseconds, All Ones = None
+    uint8_t _bestStratum;                            // Best Sample - Server Stratum
+    int32_t _offset;                                 // Last Sync - Clock Error
+    uint32_t _delay;                                 // Last Sync - Delay
+    uint8_t _stratum;                                // Last Sync - Stratum
+    // Local Time As 32.32 Fixed Point Seconds Since The Start Of The Sync
+    uint64_t LFP(const uint32_t _TICKS);
+    // Read A 32.32 Timestamp From The Packet
+    static uint64_t RFP(const uint8_t* _P);
+    // Parse A Reply - Returns: true If It Is A Good Reply To The Last Request
+    bool PRS(const uint8_t* _PACKET, const int16_t _LEN, const uint32_t _TICKS);
+    // End The Sync - Returns: DATETIMENTP_SYNCED Or _FAILED
+    uint8_t END();
+};
+
+// End Of File.
@@ -0,0 +1,380 @@
+//
+//    FILE: DateTimeRecur.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Recurrence rules for DateTimeFunctions. Gives the dates of an RFC 5545 RRULE one by one.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+#include "DateTimeRecur.h"                        // Include The DateTimeRecur Header
+
+// How it works:
+// The rule steps over periods - a day, a week (Monday first), a month or a year - INTERVAL at a time.
+// Period k is worked out straight from DTSTART (no walking), and its dates are made as a bitset of up
+// to 384 bits, one bit per day like the DateTimeBusiness year bitsets: BYMONTH, BYMONTHDAY & BYDAY
+// (with ordinals like 2TU or -1FR) set or limit the bits, then BYSETPOS picks from them. next() walks
+// the set bits and goes to the next period when they run out, so each date costs O(1) on average.
+// nextAfter() goes straight to the period of the time. With COUNT the dates before it have to be
+// counted: each earlier period is still made, but its dates are counted with a popcount per 32.bit
+// word and not a walk per day. So the cost grows with the periods since DTSTART, not the days.
+//
+// Takes: FREQ=DAILY/WEEKLY/MONTHLY/YEARLY, INTERVAL, COUNT, UNTIL, BYMONTH, BYMONTHDAY, BYDAY,
+//        BYSETPOS & WKST=MO. The time of day is the one of DTSTART. Dates before DTSTART are left out.
+// "FREQ=MONTHLY;BYDAY=2TU;UNTIL=20301231" = every 2nd Tuesday of the month up to the end of 2030.
+// "FREQ=MONTHLY;INTERVAL=3;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=-1" = last weekday of every 3rd month.
+
+// Frequencies
+#define DATETIMERECUR_DAILY   0                   // Period: Day
+#define DATETIMERECUR_WEEKLY  1                   // Period: Week - Monday First
+#define DATETIMERECUR_MONTHLY 2                   // Period: Month
+#define DATETIMERECUR_YEARLY  3                   // Period: Year
+#define DATETIMERECUR_NONE    255                 // No FREQ Yet
+
+// Day Of Week Codes - Sunday = 0
+static const char DATETIMERECUR_DAYS[] = "SUMOTUWETHFRSA";
+
+
+//---------------------- Set ----------------------//
+
+// Set The Class Object Name
+DateTimeRecur::DateTimeRecur() {
+  _freq = DATETIMERECUR_NONE;                     // No Rule
+  _done = true;                                   // No Dates
+}
+
+// Set The Rule & The Start - begin("FREQ=MONTHLY;BYDAY=2TU", dtstart) = Returns: true If Valid "0-1"
+bool DateTimeRecur::begin(const char* _RRULE, const uint64_t _DTSTART) {
+  // The Rule
+  _freq = DATETIMERECUR_NONE;                                               // No FREQ Yet
+  _interval = 1;                                                            // Every Period
+  _countMax = 0;                                                            // No COUNT
+  _until = 0xFFFFFFFFFFFFFFFFULL;                                           // No UNTIL
+  _byMonth = 0; _byMDayPos = 0; _byMDayNeg = 0;                             // No BYMONTH & BYMONTHDAY
+  _byDayCount = 0; _byDayMask = 0; _setPosCount = 0;                        // No BYDAY & BYSETPOS
+  _done = true;                                                             // No Dates Until It Is Valid
+  // The Start
+  uint8_t _hour, _min, _sec;                                                // Not Used
+  _dTF.conUT2DT(_DTSTART, _startMDay, _startMonth, _startYear, _hour, _min, _sec); // Split DTSTART
+  _start = _DTSTART;                                                        // Set DTSTART
+  _startDay = (int32_t)(_DTSTART / 86400ULL);                               // Days Since 01/01/1970
+  _tod = (uint32_t)(_DTSTART - (uint64_t)_startDay * 86400ULL);             // Seconds In The Day
+  _startDow = (uint8_t)((_startDay + 4L) % 7L);                             // 01/01/1970 Was A Thursday
+  // Parse "KEY=VALUE;KEY=VALUE"
+  if (_RRULE == NULL) return false;                                         // No Rule
+  const char* _p = _RRULE;                                                  // String Position
+  if (strncmp(_p, "RRULE:", 6) == 0) _p += 6;                               // Skip The Property Name
+  while (*_p != '\0') {
+    const char* _KEY = _p;                                                  // Key Start
+    while (*_p != '=' && *_p != ';' && *_p != '\0') _p++;                   // Find The =
+    if (*_p != '=') return false;                                           // No Value
+    if (!PRT(_KEY, (uint8_t)(_p - _KEY), _p + 1)) return false;             // Parse The Part
+    while (*_p != ';' && *_p != '\0') _p++;                                 // Find The End Of The Part
+    if (*_p == ';') _p++;                                                   // Next Part
+  }
+  if (_freq == DATETIMERECUR_NONE) return false;                            // FREQ Is Needed
+  reset();                                                                  // Go To The Start
+  return true;
+}
+
+// Go Back To The Start - reset()
+void DateTimeRecur::reset() {
+  if (_freq == DATETIMERECUR_NONE) return;                                  // No Rule
+  _count = 0;                                                               // No Dates Given
+  _done = false;                                                            // Dates To Come
+  SEK(0);                                                                   // First Period
+}
+
+
+//---------------------- Get ----------------------//
+
+// Get The Next Date - next(unixTime) = Returns: false If No More Dates
+bool DateTimeRecur::next(uint64_t& _unixTime) {
+  uint16_t _empty = 0;                                                      // Periods Looked At Without A Date
+  while (!_done) {
+    // Next Set Bit In The Period - Whole Empty Words Are Skipped
+    while (_cursor < _periodLen && !(_bits[_cursor >> 5] >> (_cursor & 31U))) _cursor = (_cursor | 31U) + 1U;
+    if (_cursor < _periodLen && !((_bits[_cursor >> 5] >> (_cursor & 31U)) & 1UL)) { _cursor++; continue; } // Not This Day
+    if (_cursor < _periodLen) {                                             // A Date
+      const int32_t _DAY = _periodDay + _cursor++;                          // The Day
+      if (_DAY < _startDay) continue;                                       // Before DTSTART
+      const uint64_t _T = (uint64_t)_DAY * 86400ULL + _tod;                 // The Time
+      if (_T < _start) continue;                                            // Before DTSTART
+      if (_T > _until || (_countMax && _count >= _countMax)) { _done = true; return false; } // UNTIL Or COUNT Reached
+      _count++;                                                             // One More Date
+      _unixTime = _T;                                                       // Set The Date
+      return true;
+    }
+    if (++_empty > DATETIMERECUR_MAX_EMPTY) { _done = true; return false; } // The Rule Has No More Dates
+    SEK(_period + 1);                                                       // Next Period
+  }
+  return false;                                                             // No More Dates
+}
+
+// Get The Next Date - next(day, month, year, hour, min, sec) = Returns: false If No More Dates
+bool DateTimeRecur::next(uint8_t& _day, uint8_t& _month, uint16_t& _year, uint8_t& _hour, uint8_t& _min, uint8_t& _sec) {
+  uint64_t _unixTime;                                                       // The Date
+  if (!next(_unixTime)) return false;                                       // No More Dates
+  _dTF.conUT2DT(_unixTime, _day, _month, _year, _hour, _min, _sec);         // Split The Date
+  return true;
+}
+
+// Get The First Date After A Time - nextAfter(unixTime, next) = Returns: false If No More Dates
+bool DateTimeRecur::nextAfter(const uint64_t _UNIXTIME, uint64_t& _next) {
+  if (_freq == DATETIMERECUR_NONE) return false;                            // No Rule
+  if (_UNIXTIME < _start) { reset(); return next(_next); }                  // Before DTSTART - The First Date
+  // The Period Of The Time - Straight From DTSTART
+  const int32_t _DAYT = (int32_t)(_UNIXTIME / 86400ULL);                    // Days Since 01/01/1970
+  uint8_t _day, _month; uint16_t _year;                                     // Date Of The Time
+  _dTF.conJDN2Gre(_DAYT + 2440588L, _day, _month, _year);                   // Split The Day
+  uint32_t _steps;                                                          // Periods Since DTSTART
+  switch (_freq) {
+    case DATETIMERECUR_DAILY:   _steps = _DAYT - _startDay; break;          // Days
+    case DATETIMERECUR_WEEKLY:  _steps = ((_DAYT - (_DAYT + 3L) % 7L) - (_startDay - (_startDay + 3L) % 7L)) / 7L; break; // Mondays
+    case DATETIMERECUR_MONTHLY: _steps = (_year * 12UL + _month) - (_startYear * 12UL + _startMonth); break; // Months
+    default:                    _steps = _year - _startYear; break;         // Years
+  }
+  const uint32_t _K = _steps / _interval;                                   // The Period
+  // COUNT - Count The Dates Of The Periods Before
+  uint16_t _before = 0;                                                     // Dates Before The Period
+  if (_countMax) {
+    for (uint32_t _k = 0; _k < _K && _before < _countMax; _k++) {
+      SEK(_k);                                                              // Make The Period
+      const uint64_t _LAST = (uint64_t)(_periodDay + _periodLen - 1) * 86400ULL + _tod; // Time Of The Last Day
+      if (_k > 0 && _LAST <= _until) {                                      // All Dates Count - Popcount The Words
+        for (uint8_t _w = 0; _w < ((_periodLen + 31U) >> 5); _w++) _before += __builtin_popcountl(_bits[_w]);
+        continue;
+      }
+      for (uint16_t _i = 0; _i < _periodLen; _i++) {                        // First Period Or UNTIL In It - Date By Date
+        if (!((_bits[_i >> 5] >> (_i & 31U)) & 1UL)) continue;              // Not A Date
+        const uint64_t _T = (uint64_t)(_periodDay + _i) * 86400ULL + _tod;  // The Time
+        if (_periodDay + (int32_t)_i >= _startDay && _T >= _start && _T <= _until) _before++; // Count It
+      }
+    }
+    if (_before >= _countMax) { _done = true; return false; }               // COUNT Reached
+  }
+  _count = _before;                                                         // Dates Given
+  _done = false;                                                            // Dates To Come
+  SEK(_K);                                                                  // Go To The Period
+  while (next(_next)) if (_next > _UNIXTIME) return true;                   // First Date After The Time
+  return false;                                                             // No More Dates
+}
+
+
+//-------------------- Private --------------------//
+
+// Parse A Number - Sign & 1-6 Digits - Returns: true If A Number & Moves _p Past It, Else _p Is Not Moved
+bool DateTimeRecur::PNM(const char*& _p, int32_t& _value) {
+  const char* _q = _p;                                                      // Read Pointer
+  bool _neg = false;                                                        // Negative
+  if (*_q == '+' || *_q == '-') _neg = (*_q++ == '-');                      // Sign
+  uint8_t _n = 0;                                                           // Digits
+  _value = 0;                                                               // The Number
+  while (*_q >= '0' && *_q <= '9' && _n < 6) { _value = _value * 10L + (*_q++ - '0'); _n++; } // Read The Digits
+  if (_n == 0) return false;                                                // Needs A Digit - A Lone Sign Is Not A Number
+  if (_neg) _value = -_value;                                               // Set The Sign
+  _p = _q;                                                                  // Move Past It
+  return true;
+}
+
+// Parse A Rule Part - Returns: true If Valid "0-1"
+bool DateTimeRecur::PRT(const char* _KEY, const uint8_t _KEYLEN, const char* _p) {
+  #define DATETIMERECUR_KEY(_NAME) (_KEYLEN == sizeof(_NAME) - 1 && strncmp(_KEY, _NAME, _KEYLEN) == 0)
+  #define DATETIMERECUR_END(_C) ((_C) == ';' || (_C) == '\0')
+  int32_t _v;                                                               // Number
+  if (DATETIMERECUR_KEY("FREQ")) {                                          // FREQ
+    static const char* const _FREQS[4] = {"DAILY", "WEEKLY", "MONTHLY", "YEARLY"};
+    for (uint8_t _f = 0; _f < 4; _f++) {
+      const uint8_t _LEN = strlen(_FREQS[_f]);                              // Name Length
+      if (strncmp(_p, _FREQS[_f], _LEN) == 0 && DATETIMERECUR_END(_p[_LEN])) { _freq = _f; return true; }
+    }
+    return false;                                                           // Unknown - HOURLY & Less Are Not Taken
+  }
+  if (DATETIMERECUR_KEY("INTERVAL") || DATETIMERECUR_KEY("COUNT")) {        // INTERVAL & COUNT - 1-65535
+    if (!PNM(_p, _v) || _v < 1 || _v > 65535L || !DATETIMERECUR_END(*_p)) return false;
+    if (_KEY[0] == 'I') _interval = _v; else _countMax = _v;                // Set It
+    return true;
+  }
+  if (DATETIMERECUR_KEY("UNTIL")) {                                         // UNTIL - YYYYMMDD Or YYYYMMDDTHHMMSS(Z)
+    uint8_t _d[14];                                                         // Digits
+    uint8_t _n = 0;                                                         // Digits Read
+    for (; _n < 14 && !DATETIMERECUR_END(*_p); _p++) {
+      if (_n == 8 && *_p == 'T') continue;                                  // Date & Time
+      if (*_p < '0' || *_p > '9') return false;                             // Not A Digit
+      _d[_n++] = *_p - '0';                                                 // Add The Digit
+    }
+    if (*_p == 'Z') _p++;                                                   // UTC
+    if ((_n != 8 && _n != 14) || !DATETIMERECUR_END(*_p)) return false;     // Not A Date Or Date Time
+    const uint16_t _Y = _d[0] * 1000U + _d[1] * 100U + _d[2] * 10U + _d[3]; // Year
+    const uint8_t _M = _d[4] * 10U + _d[5], _D = _d[6] * 10U + _d[7];       // Month & Day
+    if (!_dTF.isValidDate(_D, _M, _Y) || _Y < 1970U) return false;          // Not A Valid Date
+    const uint64_t _DAYSTART = (uint64_t)DAY(_D, _M, _Y) * 86400ULL;        // Start Of The Day
+    if (_n == 8) _until = _DAYSTART + 86399ULL;                             // Date - The Whole Day
+    else _until = _DAYSTART + (_d[8] * 10UL + _d[9]) * 3600UL + (_d[10] * 10UL + _d[11]) * 60UL + _d[12] * 10UL + _d[13];
+    return true;
+  }
+  if (DATETIMERECUR_KEY("WKST")) return strncmp(_p, "MO", 2) == 0 && DATETIMERECUR_END(_p[2]); // Weeks Start On Monday
+  // Lists
+  const uint8_t _PART = DATETIMERECUR_KEY("BYMONTH") ? 0 : DATETIMERECUR_KEY("BYMONTHDAY") ? 1 : DATETIMERECUR_KEY("BYDAY") ? 2 : DATETIMERECUR_KEY("BYSETPOS") ? 3 : 255;
+  if (_PART == 255) return false;                                           // Unknown Part
+  while (true) {
+    const bool _NUM = PNM(_p, _v);                                          // Number Or Ordinal
+    if (_PART == 0) {                                                       // BYMONTH - 1-12
+      if (!_NUM || _v < 1 || _v > 12) return false;
+      _byMonth |= 1U << _v;                                                 // Set The Month
+    }
+    else if (_PART == 1) {                                                  // BYMONTHDAY - 1-31 Or -1 ... -31
+      if (!_NUM || _v == 0 || _v < -31 || _v > 31) return false;
+      if (_v > 0) _byMDayPos |= 1UL << _v; else _byMDayNeg |= 1UL << -_v;   // Set The Day
+    }
+    else if (_PART == 2) {                                                  // BYDAY - MO, 2TU, -1FR
+      if ((_NUM && (_v == 0 || _v < -53 || _v > 53)) || _byDayCount >= DATETIMERECUR_MAX_BYDAY) return false;
+      uint8_t _dow = 0;                                                     // Day Of Week
+      while (_dow < 7 && strncmp(_p, DATETIMERECUR_DAYS + _dow * 2, 2) != 0) _dow++;
+      if (_dow == 7) return false;                                          // Unknown Day
+      _p += 2;                                                              // Past The Day
+      _byDayOrd[_byDayCount] = _NUM ? (int8_t)_v : 0;                       // Set The Ordinal
+      _byDayDow[_byDayCount++] = _dow;                                      // Set The Day
+      _byDayMask |= 1U << _dow;                                             // Set The Day Bit
+    }
+    else {                                                                  // BYSETPOS - 1-366 Or -1 ... -366
+      if (!_NUM || _v == 0 || _v < -366 || _v > 366 || _setPosCount >= DATETIMERECUR_MAX_SETPOS) return false;
+      _setPos[_setPosCount++] = _v;                                         // Set The Position
+    }
+    if (*_p == ',') { _p++; continue; }                                     // Next In The List
+    return DATETIMERECUR_END(*_p);                                          // End Of The Part
+  }
+  #undef DATETIMERECUR_KEY
+  #undef DATETIMERECUR_END
+}
+
+// Go To Period k & Make The Dates Of It
+void DateTimeRecur::SEK(const uint32_t _K) {
+  _period = _K;                                                             // Set The Period
+  _cursor = 0;                                                              // First Day
+  for (uint8_t _i = 0; _i < 12; _i++) _bits[_i] = 0;                        // No Dates
+  const uint32_t _STEP = _K * _interval;                                    // Periods Since DTSTART
+  switch (_freq) {
+    case DATETIMERECUR_DAILY:                                               // Day - Everything Limits
+      _periodDay = _startDay + (int32_t)_STEP;                              // The Day
+      _periodLen = 1;                                                       // One Day
+      if (FLT(_periodDay, true)) _bits[0] = 1;                              // The Day Is A Date
+      break;
+    case DATETIMERECUR_WEEKLY:                                              // Week - BYDAY Sets The Days, The Rest Limits
+      _periodDay = _startDay - (_startDay + 3L) % 7L + 7L * (int32_t)_STEP; // Monday
+      _periodLen = 7;                                                       // Seven Days
+      for (uint8_t _i = 0; _i < 7; _i++) {
+        const uint8_t _DOW = (_i + 1U) % 7U;                                // Day Of Week - Sunday = 0
+        const bool _DAY = _byDayCount ? (_byDayMask >> _DOW) & 1U : _DOW == _startDow; // BYDAY Or The DTSTART Day
+        if (_DAY && FLT(_periodDay + _i, false)) _bits[0] |= 1UL << _i;     // The Day Is A Date
+      }
+      break;
+    case DATETIMERECUR_MONTHLY: {                                           // Month - BYMONTH Limits
+      const uint32_t _MI = _startYear * 12UL + _startMonth - 1UL + _STEP;   // Months Since 01/0000
+      const uint16_t _Y = _MI / 12UL;                                       // Year
+      const uint8_t _M = _MI % 12UL + 1U;                                   // Month
+      if (_MI / 12UL > 65000UL) { _done = true; _periodLen = 0; break; }    // Past The Last Year
+      _periodDay = DAY(1, _M, _Y);                                          // Day 1
+      _periodLen = _dTF.getDIM(_M, _Y);                                     // Days In Month
+      if (!_byMonth || ((_byMonth >> _M) & 1U)) _bits[0] = MEX(_M, _Y, true); // The Dates Of The Month
+      break;
+    }
+    default: {                                                              // Year
+      if (_startYear + _STEP > 65000UL) { _done = true; _periodLen = 0; break; } // Past The Last Year
+      const uint16_t _Y = _startYear + _STEP;                               // Year
+      _periodDay = DAY(1, 1, _Y);                                           // 01/01
+      _periodLen = _dTF.isLeap(_Y) ? 366U : 365U;                           // Days In Year
+      if (_byMonth || _byMDayPos || _byMDayNeg) {                           // Month By Month - BYDAY Ordinals In The Month Only With BYMONTH
+        for (uint8_t _m = 1; _m <= 12; _m++) {
+          if (_byMonth && !((_byMonth >> _m) & 1U)) continue;               // Not This Month
+          ORB(MEX(_m, _Y, _byMonth != 0), _dTF.getDOY(1, _m, _Y) - 1U);     // The Dates Of The Month
+        }
+      }
+      else if (_byDayCount) {                                               // BYDAY In The Year - 20MO = 20th Monday Of The Year
+        const uint8_t _DOW1 = _dTF.getDOW(1, 1, _Y);                        // Day Of Week Of 01/01
+        for (uint8_t _e = 0; _e < _byDayCount; _e++) {
+          const uint16_t _FIRST = (_byDayDow[_e] + 7U - _DOW1) % 7U;        // First One - Day Index
+          const int8_t _ORD = _byDayOrd[_e];                                // Ordinal
+          if (_ORD == 0) for (uint16_t _i = _FIRST; _i < _periodLen; _i += 7) _bits[_i >> 5] |= 1UL << (_i & 31U); // Every One
+          else {
+            const uint16_t _LAST = _FIRST + 7U * ((_periodLen - 1U - _FIRST) / 7U); // Last One - Day Index
+            const int16_t _I = (_ORD > 0) ? _FIRST + 7 * (_ORD - 1) : _LAST + 7 * (_ORD + 1); // Nth One
+            if (_I >= 0 && _I < (int16_t)_periodLen) _bits[_I >> 5] |= 1UL << (_I & 31U); // In The Year
+          }
+        }
+      }
+      else ORB(MEX(_startMonth, _Y, true), _dTF.getDOY(1, _startMonth, _Y) - 1U); // The DTSTART Day & Month
+      break;
+    }
+  }
+  if (_setPosCount) BSP();                                                  // Pick The BYSETPOS Dates
+}
+
+// Dates Of A Month - Returns: Bits, Bit 0 = Day 1
+uint32_t DateTimeRecur::MEX(const uint8_t _MONTH, const uint16_t _YEAR, const bool _ORDINALS) {
+  // BYMONTHDAY & BYDAY set the days - When both are there, BYDAY limits. None = The DTSTART Day.
+  const uint8_t _DIM = _dTF.getDIM(_MONTH, _YEAR);                          // Days In Month
+  const uint32_t _ALL = 0xFFFFFFFFUL >> (32U - _DIM);                       // All Days
+  const bool _HASMD = _byMDayPos || _byMDayNeg;                             // BYMONTHDAY
+  uint32_t _md = (_byMDayPos >> 1) & _ALL;                                  // Days 1-31
+  for (uint8_t _k = 1; _k <= _DIM; _k++) if ((_byMDayNeg >> _k) & 1UL) _md |= 1UL << (_DIM - _k); // Days -1 ... -31
+  if (!_byDayCount) return _HASMD ? _md : (_startMDay <= _DIM ? 1UL << (_startMDay - 1U) : 0UL); // No BYDAY
+  uint32_t _bd = 0;                                                         // BYDAY Days
+  const uint8_t _DOW1 = _dTF.getDOW(1, _MONTH, _YEAR);                      // Day Of Week Of Day 1
+  for (uint8_t _e = 0; _e < _byDayCount; _e++) {
+    const uint8_t _FIRST = (_byDayDow[_e] + 7U - _DOW1) % 7U;               // First One - Day Index
+    const int8_t _ORD = _ORDINALS ? _byDayOrd[_e] : 0;                      // Ordinal
+    if (_ORD == 0) for (uint8_t _i = _FIRST; _i < _DIM; _i += 7) _bd |= 1UL << _i; // Every One
+    else {
+      const uint8_t _LAST = _FIRST + 7U * ((_DIM - 1U - _FIRST) / 7U);      // Last One - Day Index
+      const int8_t _I = (_ORD > 0) ? _FIRST + 7 * (_ORD - 1) : _LAST + 7 * (_ORD + 1); // Nth One
+      if (_I >= 0 && _I < (int8_t)_DIM) _bd |= 1UL << _I;                   // In The Month
+    }
+  }
+  return _HASMD ? (_md & _bd) : _bd;                                        // Return The Days
+}
+
+// Check A Day Against BYMONTH, BYMONTHDAY & BYDAY (Ordinals Left Out) - Returns: true If It Passes "0-1"
+bool DateTimeRecur::FLT(const int32_t _DAY, const bool _USEBYDAY) {
+  uint8_t _d, _m; uint16_t _y;                                              // The Date
+  _dTF.conJDN2Gre(_DAY + 2440588L, _d, _m, _y);                             // Split The Day
+  if (_byMonth && !((_byMonth >> _m) & 1U)) return false;                   // Not In BYMONTH
+  if (_byMDayPos || _byMDayNeg) {                                           // BYMONTHDAY
+    const uint8_t _DIM = _dTF.getDIM(_m, _y);                               // Days In Month
+    if (!((_byMDayPos >> _d) & 1UL) && !((_byMDayNeg >> (_DIM - _d + 1U)) & 1UL)) return false; // Not In BYMONTHDAY
+  }
+  if (_USEBYDAY && _byDayCount && !((_byDayMask >> (((_DAY % 7L) + 11L) % 7L)) & 1U)) return false; // Not In BYDAY
+  return true;
+}
+
+// Or Bits Into The Period At A Bit Index
+void DateTimeRecur::ORB(const uint32_t _BITS, const uint16_t _AT) {
+  const uint8_t _W = _AT >> 5, _S = _AT & 31U;                              // Word & Shift
+  _bits[_W] |= _BITS << _S;                                                 // Low Part
+  if (_S && _W < 11) _bits[_W + 1] |= _BITS >> (32U - _S);                  // High Part
+}
+
+// Keep Only The BYSETPOS Dates - 1 = First & -1 = Last Date Of The Period
+void DateTimeRecur::BSP() {
+  uint16_t _n = 0;                                                          // Dates In The Period
+  for (uint16_t _i = 0; _i < _periodLen; _i++) _n += (_bits[_i >> 5] >> (_i & 31U)) & 1UL;
+  uint32_t _keep[12] = {0};                                                 // Dates Kept
+  for (uint8_t _s = 0; _s < _setPosCount; _s++) {
+    const int16_t _WANT = (_setPos[_s] > 0) ? _setPos[_s] - 1 : (int16_t)_n + _setPos[_s]; // Date Index
+    if (_WANT < 0 || _WANT >= (int16_t)_n) continue;                        // Not In The Period
+    for (uint16_t _i = 0, _seen = 0; _i < _periodLen; _i++) {
+      if (!((_bits[_i >> 5] >> (_i & 31U)) & 1UL)) continue;                // Not A Date
+      if (_seen++ == (uint16_t)_WANT) { _keep[_i >> 5] |= 1UL << (_i & 31U); break; } // Keep It
+    }
+  }
+  for (uint8_t _i = 0; _i < 12; _i++) _bits[_i] = _keep[_i];                // Set The Dates
+}
+
+// Days Since 01/01/1970 - Negative Before
+int32_t DateTimeRecur::DAY(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR) {
+  return _dTF.conGre2JDN(_DAY, _MONTH, _YEAR) - 2440588L;                   // Julian Day Number Less 01/01/1970
+}
+
+// End Of File.
@@ -0,0 +1,74 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeRecur.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Recurrence rules for DateTimeFunctions. Gives the dates of an RFC 5545 RRULE one by one.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// Include
+#include "DateTimeFunctions.h"                       // Include The DateTimeFunctions Library
+
+// Settings
+#define DATETIMERECUR_MAX_BYDAY  8                   // Max BYDAY Entries - 2.bytes Each
+#define DATETIMERECUR_MAX_SETPOS 4                   // Max BYSETPOS Entries - 2.bytes Each
+#define DATETIMERECUR_MAX_EMPTY  4000                // Periods In A Row With No Date Before The Rule Ends
+
+
+class DateTimeRecur {
+  public:                                            // Public
+    // Set
+    DateTimeRecur();                                                                                                    // Set The Class Object Name
+    bool begin(const char* _RRULE, const uint64_t _DTSTART);                                                            // Set The Rule & The Start - false = Not Valid
+    void reset();                                                                                                       // Go Back To The Start
+    // Get
+    bool next(uint64_t& _unixTime);                                                                                     // Get The Next Date
+    bool next(uint8_t& _day, uint8_t& _month, uint16_t& _year, uint8_t& _hour, uint8_t& _min, uint8_t& _sec);           // Get The Next Date - As Date Time Fields
+    bool nextAfter(const uint64_t _UNIXTIME, uint64_t& _next);                                                          // Get The First Date After A Time - next() Goes On From It
+
+  private:                                           // Private
+    // The Rule
+    uint64_t _start;                                 // DTSTART
+    uint64_t _until;                                 // UNTIL - Last Time, All Ones = None
+    int32_t _startDay;                               // DTSTART - Days Since 01/01/1970
+    uint32_t _tod;                                   // DTSTART - Seconds In The Day
+    uint16_t _startYear;                             // DTSTART - Year
+    uint8_t _startMonth, _startMDay, _startDow;      // DTSTART - Month, Day Of Month & Day Of Week
+    uint8_t _freq;                                   // FREQ
+    uint16_t _interval;                              // INTERVAL
+    uint16_t _countMax;                              // COUNT - 0 = None
+    uint16_t _byMonth;                               // BYMONTH - Bit 1 = January ... Bit 12 = December
+    uint32_t _byMDayPos, _byMDayNeg;                 // BYMONTHDAY - Bit d = Day d & Bit d = Day -d
+    int8_t _byDayOrd[DATETIMERECUR_MAX_BYDAY];       // BYDAY - Ordinal, 0 = Every
+    uint8_t _byDayDow[DATETIMERECUR_MAX_BYDAY];      // BYDAY - Day Of Week 0-6 "Sunday = 0"
+    uint8_t _byDayCount;                             // BYDAY Entries
+    uint8_t _byDayMask;                              // BYDAY - Bit Per Day Of Week, Ordinals Left Out
+    int16_t _setPos[DATETIMERECUR_MAX_SETPOS];       // BYSETPOS
+    uint8_t _setPosCount;                            // BYSETPOS Entries
+    // The Iterator
+    uint32_t _period;                                // Period Since The Start - Steps Of INTERVAL
+    int32_t _periodDay;                              // First Day Of The Period - Days Since 01/01/1970
+    uint16_t _periodLen;                             // Days In The Period
+    uint16_t _cursor;                                // Next Day To Look At In The Period
+    uint16_t _count;                                 // Dates Given
+    bool _done;                                      // No More Dates
+    uint32_t _bits[12];                              // Dates In The Period - Bit 0 Of Word 0 = First Day
+    DateTimeFunctions _dTF;                          // Date Functions
+    // Parse - A Number & The Rule Parts
+    static bool PNM(const char*& _p, int32_t& _value);
+    bool PRT(const char* _KEY, const uint8_t _KEYLEN, const char* _p);
+    // Go To Period k & Make The Dates Of It
+    void SEK(const uint32_t _K);
+    // Month - Dates Of A Month As Bits - Bit 0 = Day 1
+    uint32_t MEX(const uint8_t _MONTH, const uint16_t _YEAR, const bool _ORDINALS);
+    // Check A Day Against BYMONTH, BYMONTHDAY & BYDAY
+    bool FLT(const int32_t _DAY, const bool _USEBYDAY);
+    // Or Bits Into The Period At A Bit Index & Keep Only The BYSETPOS Dates
+    void ORB(const uint32_t _BITS, const uint16_t _AT);
+    void BSP();
+    // Days Since 01/01/1970
+    int32_t DAY(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR);
+};
+
+// End Of File.
@@ -0,0 +1,140 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeRing.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Time indexed ring buffer for DateTimeFunctions. Keeps the last N values with their timestamps.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+// Include
+#include "DateTimeFunctions.h"                       // Include The DateTimeFunctions Library
+
+// How it works:
+// The timestamps & the values are kept in two fixed arrays of _SIZE, so nothing is allocated.
+// _head is the oldest entry & the entries run on from it, wrapping at the end of the arrays.
+// Entry i (0 = oldest) is at _head + i, less _SIZE if past the end, so the timestamps read in
+// entry order never go down and can be binary searched across the wrap point.
+// When the buffer is full the oldest entry is dropped by moving _head one on - O(1).
+// It is a template, so it all lives in this header: DateTimeRing<float, 512> temps;
+
+
+template <class T, uint32_t _SIZE> class DateTimeRing {
+  public:                                            // Public
+    //---------------------- Set ----------------------//
+
+    // Set The Class Object Name
+    DateTimeRing() : _head(0), _count(0) {}
+
+    // Add A Value - push(unixTime, value) = Returns: false If The Time Is Before The Newest Entry
+    bool push(const uint64_t _UNIXTIME, const T& _VALUE) {
+      if (_count > 0 && _UNIXTIME < _time[PHY(_count - 1)]) return false; // Time Went Back
+      if (_count == _SIZE) pop();                                       // Full - Drop The Oldest
+      const uint32_t _AT = PHY(_count);                                 // Where The New Entry Goes
+      _time[_AT] = _UNIXTIME;                                           // Set The Time
+      _value[_AT] = _VALUE;                                             // Set The Value
+      _count++;                                                         // One More
+      return true;
+    }
+
+    // Drop The Oldest Entry - pop() = Returns: false If Empty
+    bool pop() {
+      if (_count == 0) return false;                                    // Empty
+      if (++_head == _SIZE) _head = 0;                                  // Move The Head On
+      _count--;                                                         // One Less
+      return true;
+    }
+
+    // Drop The Entries Before A Time - dropBefore(unixTime) = Returns: Entries Dropped
+    uint32_t dropBefore(const uint64_t _UNIXTIME) {
+      const uint32_t _N = lowerBound(_UNIXTIME);                        // Entries Before The Time
+      _head = PHY(_N);                                                  // Move The Head On
+      _count -= _N;                                                     // Less Entries
+      if (_count == 0) _head = 0;                                       // Start Again
+      return _N;
+    }
+
+    // Drop All Entries
+    void clear() { _head = 0; _count = 0; }
+
+    //--------------------- Check ---------------------//
+
+    bool isEmpty() { return _count == 0; }                              // Check For Empty
+    bool isFull()  { return _count == _SIZE; }                          // Check For Full
+
+    //---------------------- Get ----------------------//
+
+    uint32_t getCount()    { return _count; }                           // Get The Entries - 0 ... _SIZE
+    uint32_t getCapacity() { return _SIZE; }                            // Get The Size
+
+    // Get Entry i - 0 = Oldest & getCount() - 1 = Newest
+    uint64_t getTime(const uint32_t _I) { return _time[PHY(_I)]; }      // Get The Time Of Entry i
+    T& getValue(const uint32_t _I) { return _value[PHY(_I)]; }          // Get The Value Of Entry i
+
+    // First Entry At Or After A Time - lowerBound(unixTime) = Returns: 0 ... getCount()
+    uint32_t lowerBound(const uint64_t _UNIXTIME) {
+      uint32_t _low = 0, _high = _count;                                // Search Entries _low ... _high
+      while (_low < _high) {
+        const uint32_t _MID = _low + ((_high - _low) >> 1);             // Middle Entry
+        if (_time[PHY(_MID)] < _UNIXTIME) _low = _MID + 1;              // Search The Newer Half
+        else _high = _MID;                                              // Search The Older Half
+      }
+      return _low;
+    }
+
+    // First Entry After A Time - upperBound(unixTime) = Returns: 0 ... getCount()
+    uint32_t upperBound(const uint64_t _UNIXTIME) {
+      uint32_t _low = 0, _high = _count;                                // Search Entries _low ... _high
+      while (_low < _high) {
+        const uint32_t _MID = _low + ((_high - _low) >> 1);             // Middle Entry
+        if (_time[PHY(_MID)] <= _UNIXTIME) _low = _MID + 1;             // Search The Newer Half
+        else _high = _MID;                                              // Search The Older Half
+      }
+      return _low;
+    }
+
+    // Entries From A Time Up To, Not With, A Time - range(from, to, first) = Returns: Entries, Sets: _first
+    uint32_t range(const uint64_t _FROM, const uint64_t _TO, uint32_t& _first) {
+      _first = lowerBound(_FROM);                                       // First Entry
+      if (_TO <= _FROM) return 0;                                       // Nothing
+      return lowerBound(_TO) - _first;                                  // Entries In The Range
+    }
+
+    //-------------------- Print ----------------------//
+
+    // Print The Time Of Entry i - printTime(Serial, i, false/true) = Returns: Characters Written
+    size_t printTime(Print& _out, const uint32_t _I, const bool _USEMONTHNAME = false) {
+      return _dTF.printDateTime(_out, _time[PHY(_I)], _USEMONTHNAME);   // Use printDateTime()
+    }
+
+    // Print The Entries From A Time Up To, Not With, A Time - One Line Each, The Value By _printValue() If Set
+    // _printValue() returns the characters it wrote, like print(). printRange(Serial, from, to, false/true, printValue) = Returns: Characters Written
+    size_t printRange(Print& _out, const uint64_t _FROM, const uint64_t _TO, const bool _USEMONTHNAME = false, size_t (*_printValue)(Print&, const T&) = 0) {
+      uint32_t _i;                                                      // First Entry
+      const uint32_t _N = range(_FROM, _TO, _i);                        // Entries In The Range
+      size_t _n = 0;                                                    // Characters Written
+      for (const uint32_t _END = _i + _N; _i < _END; _i++) {
+        _n += printTime(_out, _i, _USEMONTHNAME);                       // Print The Time
+        if (_printValue) { _n += _out.write((uint8_t)' '); _n += _printValue(_out, _value[PHY(_i)]); } // Print The Value
+        _n += _out.write((uint8_t)'\n');                                // New Line
+      }
+      return _n;
+    }
+
+  private:                                           // Private
+    uint64_t _time[_SIZE];                           // Timestamps
+    T _value[_SIZE];                                 // Values
+    uint32_t _head;                                  // Oldest Entry
+    uint32_t _count;                                 // Entries
+    DateTimeFunctions _dTF;                          // Date Functions
+    // Entry To Array Index - No Divide
+    uint32_t PHY(const uint32_t _I) {
+      const uint32_t _AT = _head + _I;                                  // Index Past The Head
+      return (_AT >= _SIZE) ? _AT - _SIZE : _AT;                        // Wrap
+    }
+};
+
+// End Of File.
@@ -0,0 +1,180 @@
+//
+//    FILE: DateTimeValue.cpp
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Date time value for DateTimeFunctions. Split once, then work out the derived fields on first use.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+// HISTORY
+//   1.0.0  19/10/2026  Initial version
+//
+
+#include "DateTimeValue.h"                        // Include The DateTimeValue Header
+
+// How it works:
+// The unix time is split into the date time fields once, when it is set. The derived fields
+// (day of week, day of year, week of year, leap year & unix time when set from fields) are worked
+// out the first time they are asked for and kept, with one bit in _have for each. The week of year
+// uses the kept day of week & day of year, so it needs no more getDOW() calls.
+
+// Worked Out Fields - _have Bits
+#define DATETIMEVALUE_UT     0x01                 // Unix Time
+#define DATETIMEVALUE_DOW    0x02                 // Day Of Week
+#define DATETIMEVALUE_DOY    0x04                 // Day Of Year
+#define DATETIMEVALUE_WOY    0x08                 // Week Of Year
+#define DATETIMEVALUE_LEAP   0x10                 // Leap Year Is Worked Out
+#define DATETIMEVALUE_ISLEAP 0x20                 // Leap Year
+
+
+//---------------------- Set ----------------------//
+
+// Set From Unix Time
+DateTimeValue::DateTimeValue(const uint64_t _UNIXTIME) {
+  set(_UNIXTIME);                                 // Split The Unix Time
+}
+
+// Set From Date Time
+DateTimeValue::DateTimeValue(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC) {
+  set(_DAY, _MONTH, _YEAR, _HOUR, _MIN, _SEC);    // Set The Fields
+}
+
+// Set From Unix Time - set(unixTime)
+void DateTimeValue::set(const uint64_t _UNIXTIME) {
+  _dTF.conUT2DT(_UNIXTIME, _day, _month, _year, _hour, _min, _sec); // Split The Unix Time - Once
+  _unixTime = _UNIXTIME;                                                // Set The Unix Time
+  _have = DATETIMEVALUE_UT;                                             // Only The Unix Time Is Known
+}
+
+// Set From Date Time - set(day, month, year, hour, min, sec)
+void DateTimeValue::set(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR, const uint8_t _MIN, const uint8_t _SEC) {
+  _day = _DAY;                                                          // Set The Day
+  _month = _MONTH;                                                      // Set The Month
+  _year = _YEAR;                                                        // Set The Year
+  _hour = _HOUR;                                                        // Set The Hour
+  _min = _MIN;                                                          // Set The Minute
+  _sec = _SEC;                                                          // Set The Second
+  _have = 0;                                                            // Nothing Worked Out
+}
+
+
+//--------------------- Check ---------------------//
+
+// Check For Valid Date Time - isValid() = Returns: true If Valid "0-1"
+bool DateTimeValue::isValid() {
+  return _dTF.isValidDateTime(_day, _month, _year, _hour, _min, _sec);  // Use isValidDateTime()
+}
+
+// Check For Leap Year - isLeap() = Returns: true If Leap Year "0-1"
+bool DateTimeValue::isLeap() {
+  if (!(_have & DATETIMEVALUE_LEAP)) {                                  // Work It Out
+    _have |= DATETIMEVALUE_LEAP;                                        // Worked Out
+    if (_dTF.isLeap(_year)) _have |= DATETIMEVALUE_ISLEAP;              // Leap Year
+  }
+  return _have & DATETIMEVALUE_ISLEAP;                                  // Return Leap Year
+}
+
+// Check For AM / PM - isPM() = Returns: true If PM "0-1"
+bool DateTimeValue::isPM() {
+  return _hour >= 12;                                                   // Return PM
+}
+
+
+//---------------------- Get ----------------------//
+
+// Get The Fields - Returns: The Field
+uint8_t DateTimeValue::getDay()    { return _day; }                     // Return The Day
+uint8_t DateTimeValue::getMonth()  { return _month; }                   // Return The Month
+uint16_t DateTimeValue::getYear()  { return _year; }                    // Return The Year
+uint8_t DateTimeValue::getHour()   { return _hour; }                    // Return The Hour
+uint8_t DateTimeValue::getMin()    { return _min; }                     // Return The Minute
+uint8_t DateTimeValue::getSec()    { return _sec; }                     // Return The Second
+
+// Get The Unix Time - getUnixTime() = Returns: Seconds Since 01/01/1970 - 00:00:00, 0 Before 1970
+uint64_t DateTimeValue::getUnixTime() {
+  if (!(_have & DATETIMEVALUE_UT)) {                                    // Work It Out
+    const int32_t _DAYS = _dTF.conGre2JDN(_day, _month, _year) - 2440588L; // Days Since 01/01/1970
+    _unixTime = (_DAYS < 0L) ? 0ULL : (uint64_t)_DAYS * 86400ULL + _hour * 3600UL + _min * 60U + _sec;
+    _have |= DATETIMEVALUE_UT;                                          // Worked Out
+  }
+  return _unixTime;                                                     // Return The Unix Time
+}
+
+// Get Day Of Week - getDOW() = Returns: 0-6 "Sunday = 0"
+uint8_t DateTimeValue::getDOW() {
+  if (!(_have & DATETIMEVALUE_DOW)) {                                   // Work It Out
+    _dow = _dTF.getDOW(_day, _month, _year);                            // Day Of Week
+    _have |= DATETIMEVALUE_DOW;                                         // Worked Out
+  }
+  return _dow;                                                          // Return The Day Of Week
+}
+
+// Get Day Of Year - getDOY() = Returns: 1-366
+uint16_t DateTimeValue::getDOY() {
+  if (!(_have & DATETIMEVALUE_DOY)) {                                   // Work It Out
+    _doy = _dTF.getDOY(_day, _month, _year);                            // Day Of Year
+    _have |= DATETIMEVALUE_DOY;                                         // Worked Out
+  }
+  return _doy;                                                          // Return The Day Of Year
+}
+
+// Get Week Of Year - getWOY() = Returns: 1-53 "ISO 8601"
+uint8_t DateTimeValue::getWOY() {
+  if (!(_have & DATETIMEVALUE_WOY)) {                                   // Work It Out - The Same As DateTimeFunctions::getWOY()
+    const uint16_t _DOY = getDOY();                                     // Day Of Year
+    const uint8_t _DOW = getDOW();                                      // Day Of Week - Sunday = 0
+    _woy = (10U + _DOY - (_DOW == 0 ? 7U : _DOW)) / 7U;                 // Week Of Year - Raw, Monday = 1 & Sunday = 7
+    if (_woy == 53) {                                                   // December
+      const uint8_t _DEC31 = (_DOW + getDIY() - _DOY) % 7U;             // Weekday Of 31/12 - From The Kept Day Of Week
+      if (_DEC31 >= 1 && _DEC31 <= 3) _woy = 1;                         // Dec 31 Is On Monday, Tuesday, or Wednesday
+      else if (_DEC31 == 5) _woy = isLeap() ? 53 : 52;                  // Dec 31 Is On Friday
+      else if (_DEC31 != 4) _woy = 52;                                  // Dec 31 Is On Saturday or Sunday
+    }
+    else if (_woy == 0) {                                               // January
+      const uint8_t _JAN1 = (_DOW + 371U - _DOY + 1U) % 7U;             // Weekday Of 01/01 - From The Kept Day Of Week
+      if (_JAN1 == 5) _woy = 53;                                        // Jan 1 Is On Friday
+      else if (_JAN1 == 6) _woy = isLeap() ? 53 : 52;                   // Jan 1 Is On Saturday
+      else if (_JAN1 == 0) _woy = 52;                                   // Jan 1 Is On Sunday
+      else _woy = 1;                                                    // Jan 1 Is On Monday, Tuesday, Wednesday or Thursday
+    }
+    _have |= DATETIMEVALUE_WOY;                                         // Worked Out
+  }
+  return _woy;                                                          // Return The Week Of Year
+}
+
+// Get Days In Year - getDIY() = Returns: 365-366
+uint16_t DateTimeValue::getDIY() {
+  return isLeap() ? 366U : 365U;                                        // Return The Days In Year
+}
+
+// Get Days Left In Year - getDLIY() = Returns: 0-365
+uint16_t DateTimeValue::getDLIY() {
+  return getDIY() - getDOY();                                           // Return The Days Left In Year
+}
+
+// Get Days In Month - getDIM() = Returns: 28-31
+uint8_t DateTimeValue::getDIM() {
+  return _dTF.getDIM(_month, _year);                                    // Return The Days In Month
+}
+
+// Get The Names - Returns: The Name (Static Buffer)
+char* DateTimeValue::getDOWNS() { return _dTF.getDOWNS(getDOW()); }     // Return Sun ... Sat
+char* DateTimeValue::getDOWNL() { return _dTF.getDOWNL(getDOW()); }     // Return Sunday ... Saturday
+char* DateTimeValue::getMNS()   { return _dTF.getMNS(_month); }         // Return Jan ... Dec
+char* DateTimeValue::getMNL()   { return _dTF.getMNL(_month); }         // Return January ... December
+
+
+//--------------------- Date ----------------------//
+
+// Date Time To String - dateTime2Str(buffer, false/true) = Returns: DD/MM/YYYY - HH:MM:SS Or DD/Jan/YYYY - HH:MM:SS
+char* DateTimeValue::dateTime2Str(char* _BUFFER, const bool _USEMONTHNAME) {
+  // The Same As conUT2DT() - From The Kept Fields, No Split. _BUFFER needs to be 27.bytes.
+  return _dTF.MTDTS(_BUFFER, _day, _month, _year, _hour, _min, _sec, _USEMONTHNAME ? 1 : 0); // Use MTDTS() - Type 0 / 1
+}
+
+// Date To String - date2Str(buffer, false/true) = Returns: DD/MM/YYYY Or DD/Jan/YYYY
+char* DateTimeValue::date2Str(char* _BUFFER, const bool _USEMONTHNAME) {
+  // The Same As DateTimeFunctions::date2Str(). _BUFFER needs to be 27.bytes.
+  return _dTF.MTDTS(_BUFFER, _day, _month, _year, 0, 0, 0, _USEMONTHNAME ? 3 : 2); // Use MTDTS() - Type 2 / 3
+}
+
+// End Of File.
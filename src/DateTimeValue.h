@@ -0,0 +1,58 @@
+#pragma once                                         // Run Once
+//
+//    FILE: DateTimeValue.h
+//  AUTHOR: XbergCode
+// VERSION: 1.0.0
+// PURPOSE: Date time value for DateTimeFunctions. Split once, then work out the derived fields on first use.
+//     URL: https://github.com/XbergCode/DateTimeFunctions
+//
+
+// Include
+#include "DateTimeFunctions.h"                       // Include The DateTimeFunctions Library
+
+
+class DateTimeValue {
+  public:                                            // Public
+    // Set
+    DateTimeValue(const uint64_t _UNIXTIME = 0ULL);                                                                     // Set From Unix Time
+    DateTimeValue(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR = 0, const uint8_t _MIN = 0, const uint8_t _SEC = 0); // Set From Date Time
+    void set(const uint64_t _UNIXTIME);                                                                                 // Set From Unix Time
+    void set(const uint8_t _DAY, const uint8_t _MONTH, const uint16_t _YEAR, const uint8_t _HOUR = 0, const uint8_t _MIN = 0, const uint8_t _SEC = 0); // Set From Date Time
+    // Check
+    bool isValid();                                                                                                     // Check For Valid Date Time
+    bool isLeap();                                                                                                      // Check For Leap Year
+    bool isPM();                                                                                                        // Check For AM / PM
+    // Get - The Fields
+    uint8_t getDay();                                                                                                   // Get The Day
+    uint8_t getMonth();                                                                                                 // Get The Month
+    uint16_t getYear();                                                                                                 // Get The Year
+    uint8_t getHour();                                                                                                  // Get The Hour
+    uint8_t getMin();                                                                                                   // Get The Minute
+    uint8_t getSec();                                                                                                   // Get The Second
+    uint64_t getUnixTime();                                                                                             // Get The Unix Time
+    // Get - Worked Out On First Use
+    uint8_t getDOW();                                                                                                   // Get Day Of Week
+    uint16_t getDOY();                                                                                                  // Get Day Of Year
+    uint8_t getWOY();                                                                                                   // Get Week Of Year
+    uint16_t getDIY();                                                                                                  // Get Days In Year
+    uint16_t getDLIY();                                                                                                 // Get Days Left In Year
+    uint8_t getDIM();                                                                                                   // Get Days In Month
+    char* getDOWNS();                                                                                                   // Get Day Of Week Name Short
+    char* getDOWNL();                                                                                                   // Get Day Of Week Name Long
+    char* getMNS();                                                                                                     // Get Month Name Short
+    char* getMNL();                                                                                                     // Get Month Name Long
+    // Date & Clock
+    char* dateTime2Str(char* _BUFFER, const bool _USEMONTHNAME = false);                                                // Date Time To String - 27.bytes
+    char* date2Str(char* _BUFFER, const bool _USEMONTHNAME = false);                                                    // Date To String - 27.bytes
+
+  private:                                           // Private
+    uint64_t _unixTime;                              // Unix Time
+    uint16_t _year;                                  // Year
+    uint8_t _month, _day, _hour, _min, _sec;         // Date Time Fields
+    uint8_t _dow, _woy;                              // Day Of Week & Week Of Year
+    uint16_t _doy;                                   // Day Of Year
+    uint8_t _have;                                   // Worked Out Fields - One Bit Each
+    DateTimeFunctions _dTF;                          // Date Functions
+};
+
+// End Of File.